@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/bitboard_kernels.cpp" "CMakeFiles/frame_allocation_test.dir/src/bitboard_kernels.cpp.o" "gcc" "CMakeFiles/frame_allocation_test.dir/src/bitboard_kernels.cpp.o.d"
+  "/root/repo/src/frame_allocation_test.cpp" "CMakeFiles/frame_allocation_test.dir/src/frame_allocation_test.cpp.o" "gcc" "CMakeFiles/frame_allocation_test.dir/src/frame_allocation_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel/dependencies/SDL2/CMakeFiles/SDL2main.dir/DependInfo.cmake"
+  "/root/repo/_rel/dependencies/SDL2/CMakeFiles/SDL2-static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
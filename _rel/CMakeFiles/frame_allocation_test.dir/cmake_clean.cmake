@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frame_allocation_test.dir/src/bitboard_kernels.cpp.o"
+  "CMakeFiles/frame_allocation_test.dir/src/bitboard_kernels.cpp.o.d"
+  "CMakeFiles/frame_allocation_test.dir/src/frame_allocation_test.cpp.o"
+  "CMakeFiles/frame_allocation_test.dir/src/frame_allocation_test.cpp.o.d"
+  "frame_allocation_test"
+  "frame_allocation_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frame_allocation_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gridoflife.dir/src/bitboard_kernels.cpp.o"
+  "CMakeFiles/gridoflife.dir/src/bitboard_kernels.cpp.o.d"
+  "CMakeFiles/gridoflife.dir/src/gridoflife.cpp.o"
+  "CMakeFiles/gridoflife.dir/src/gridoflife.cpp.o.d"
+  "CMakeFiles/gridoflife.dir/src/internal_sdl_state.cpp.o"
+  "CMakeFiles/gridoflife.dir/src/internal_sdl_state.cpp.o.d"
+  "gridoflife"
+  "gridoflife.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gridoflife.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dependencies/imgui/imgui.cpp" "CMakeFiles/imgui.dir/dependencies/imgui/imgui.cpp.o" "gcc" "CMakeFiles/imgui.dir/dependencies/imgui/imgui.cpp.o.d"
+  "/root/repo/dependencies/imgui/imgui_demo.cpp" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_demo.cpp.o" "gcc" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_demo.cpp.o.d"
+  "/root/repo/dependencies/imgui/imgui_draw.cpp" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_draw.cpp.o" "gcc" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_draw.cpp.o.d"
+  "/root/repo/dependencies/imgui/imgui_tables.cpp" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_tables.cpp.o" "gcc" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_tables.cpp.o.d"
+  "/root/repo/dependencies/imgui/imgui_widgets.cpp" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_widgets.cpp.o" "gcc" "CMakeFiles/imgui.dir/dependencies/imgui/imgui_widgets.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
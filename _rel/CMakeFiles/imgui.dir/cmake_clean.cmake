@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui.cpp.o"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui.cpp.o.d"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_demo.cpp.o"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_demo.cpp.o.d"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_draw.cpp.o"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_draw.cpp.o.d"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_tables.cpp.o"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_tables.cpp.o.d"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_widgets.cpp.o"
+  "CMakeFiles/imgui.dir/dependencies/imgui/imgui_widgets.cpp.o.d"
+  "libimgui.a"
+  "libimgui.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imgui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_rel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(frame_allocation_test "/root/repo/_rel/frame_allocation_test")
+set_tests_properties(frame_allocation_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;170;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("dependencies/SDL2")
@@ -0,0 +1,208 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dependencies/SDL2/src/SDL.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_assert.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_assert.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_assert.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_dataqueue.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_dataqueue.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_dataqueue.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_error.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_error.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_error.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_guid.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_guid.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_guid.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_hints.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_hints.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_hints.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_list.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_list.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_list.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_log.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_log.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_log.c.o.d"
+  "/root/repo/dependencies/SDL2/src/SDL_utils.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_utils.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/SDL_utils.c.o.d"
+  "/root/repo/dependencies/SDL2/src/atomic/SDL_atomic.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/atomic/SDL_atomic.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/atomic/SDL_atomic.c.o.d"
+  "/root/repo/dependencies/SDL2/src/atomic/SDL_spinlock.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/atomic/SDL_spinlock.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/atomic/SDL_spinlock.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/SDL_audio.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audio.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audio.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/SDL_audiocvt.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audiocvt.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audiocvt.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/SDL_audiodev.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audiodev.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audiodev.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/SDL_audiotypecvt.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audiotypecvt.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/SDL_mixer.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_mixer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_mixer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/SDL_wave.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_wave.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/SDL_wave.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/disk/SDL_diskaudio.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/disk/SDL_diskaudio.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/dsp/SDL_dspaudio.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/dsp/SDL_dspaudio.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/dsp/SDL_dspaudio.c.o.d"
+  "/root/repo/dependencies/SDL2/src/audio/dummy/SDL_dummyaudio.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/dummy/SDL_dummyaudio.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "/root/repo/dependencies/SDL2/src/core/linux/SDL_evdev.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_evdev.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_evdev.c.o.d"
+  "/root/repo/dependencies/SDL2/src/core/linux/SDL_evdev_capabilities.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_evdev_capabilities.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_evdev_capabilities.c.o.d"
+  "/root/repo/dependencies/SDL2/src/core/linux/SDL_evdev_kbd.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_evdev_kbd.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_evdev_kbd.c.o.d"
+  "/root/repo/dependencies/SDL2/src/core/linux/SDL_sandbox.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_sandbox.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_sandbox.c.o.d"
+  "/root/repo/dependencies/SDL2/src/core/linux/SDL_threadprio.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_threadprio.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/linux/SDL_threadprio.c.o.d"
+  "/root/repo/dependencies/SDL2/src/core/unix/SDL_poll.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/unix/SDL_poll.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/core/unix/SDL_poll.c.o.d"
+  "/root/repo/dependencies/SDL2/src/cpuinfo/SDL_cpuinfo.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/cpuinfo/SDL_cpuinfo.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "/root/repo/dependencies/SDL2/src/dynapi/SDL_dynapi.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/dynapi/SDL_dynapi.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/dynapi/SDL_dynapi.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_clipboardevents.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_clipboardevents.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_clipboardevents.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_displayevents.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_displayevents.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_displayevents.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_dropevents.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_dropevents.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_dropevents.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_events.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_events.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_events.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_gesture.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_gesture.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_gesture.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_keyboard.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_keyboard.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_keyboard.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_keysym_to_scancode.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_keysym_to_scancode.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_keysym_to_scancode.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_mouse.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_mouse.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_mouse.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_quit.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_quit.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_quit.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_scancode_tables.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_scancode_tables.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_scancode_tables.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_touch.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_touch.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_touch.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/SDL_windowevents.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_windowevents.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/SDL_windowevents.c.o.d"
+  "/root/repo/dependencies/SDL2/src/events/imKStoUCS.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/imKStoUCS.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/events/imKStoUCS.c.o.d"
+  "/root/repo/dependencies/SDL2/src/file/SDL_rwops.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/file/SDL_rwops.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/file/SDL_rwops.c.o.d"
+  "/root/repo/dependencies/SDL2/src/filesystem/unix/SDL_sysfilesystem.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/filesystem/unix/SDL_sysfilesystem.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "/root/repo/dependencies/SDL2/src/haptic/SDL_haptic.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/haptic/SDL_haptic.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/haptic/SDL_haptic.c.o.d"
+  "/root/repo/dependencies/SDL2/src/haptic/linux/SDL_syshaptic.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/haptic/linux/SDL_syshaptic.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "/root/repo/dependencies/SDL2/src/hidapi/SDL_hidapi.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/hidapi/SDL_hidapi.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/hidapi/SDL_hidapi.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/SDL_gamecontroller.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/SDL_gamecontroller.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/SDL_gamecontroller.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/SDL_joystick.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/SDL_joystick.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/SDL_joystick.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/controller_type.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/controller_type.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/controller_type.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_combined.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_combined.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_gamecube.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_gamecube.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_luna.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_luna.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_ps3.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_ps3.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_ps4.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_ps4.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_ps5.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_ps5.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_rumble.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_rumble.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_shield.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_shield.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_stadia.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_stadia.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_steam.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_steam.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_switch.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_switch.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_wii.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_wii.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_xbox360.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_xbox360w.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_xbox360w.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapi_xboxone.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapi_xboxone.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/hidapi/SDL_hidapijoystick.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/hidapi/SDL_hidapijoystick.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/linux/SDL_sysjoystick.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/linux/SDL_sysjoystick.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/steam/SDL_steamcontroller.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/steam/SDL_steamcontroller.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/steam/SDL_steamcontroller.c.o.d"
+  "/root/repo/dependencies/SDL2/src/joystick/virtual/SDL_virtualjoystick.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/virtual/SDL_virtualjoystick.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/joystick/virtual/SDL_virtualjoystick.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_atan2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_atan2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_atan2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_exp.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_exp.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_exp.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_fmod.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_fmod.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_fmod.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_log.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_log.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_log.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_log10.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_log10.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_log10.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_pow.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_pow.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_pow.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_rem_pio2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_rem_pio2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_rem_pio2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/e_sqrt.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_sqrt.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/e_sqrt.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/k_cos.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_cos.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_cos.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/k_rem_pio2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_rem_pio2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_rem_pio2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/k_sin.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_sin.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_sin.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/k_tan.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_tan.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/k_tan.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_atan.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_atan.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_atan.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_copysign.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_copysign.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_copysign.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_cos.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_cos.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_cos.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_fabs.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_fabs.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_fabs.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_floor.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_floor.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_floor.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_scalbn.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_scalbn.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_scalbn.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_sin.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_sin.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_sin.c.o.d"
+  "/root/repo/dependencies/SDL2/src/libm/s_tan.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_tan.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/libm/s_tan.c.o.d"
+  "/root/repo/dependencies/SDL2/src/loadso/dlopen/SDL_sysloadso.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/loadso/dlopen/SDL_sysloadso.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "/root/repo/dependencies/SDL2/src/locale/SDL_locale.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/locale/SDL_locale.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/locale/SDL_locale.c.o.d"
+  "/root/repo/dependencies/SDL2/src/locale/unix/SDL_syslocale.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/locale/unix/SDL_syslocale.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/locale/unix/SDL_syslocale.c.o.d"
+  "/root/repo/dependencies/SDL2/src/misc/SDL_url.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/misc/SDL_url.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/misc/SDL_url.c.o.d"
+  "/root/repo/dependencies/SDL2/src/misc/unix/SDL_sysurl.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/misc/unix/SDL_sysurl.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/misc/unix/SDL_sysurl.c.o.d"
+  "/root/repo/dependencies/SDL2/src/power/SDL_power.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/power/SDL_power.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/power/SDL_power.c.o.d"
+  "/root/repo/dependencies/SDL2/src/power/linux/SDL_syspower.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/power/linux/SDL_syspower.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/power/linux/SDL_syspower.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/SDL_d3dmath.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/SDL_d3dmath.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/SDL_d3dmath.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/SDL_render.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/SDL_render.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/SDL_render.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/SDL_yuv_sw.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/SDL_yuv_sw.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/SDL_yuv_sw.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/direct3d/SDL_render_d3d.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d/SDL_render_d3d.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d/SDL_render_d3d.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/direct3d/SDL_shaders_d3d.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d/SDL_shaders_d3d.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d/SDL_shaders_d3d.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/direct3d11/SDL_render_d3d11.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d11/SDL_render_d3d11.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d11/SDL_render_d3d11.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/direct3d11/SDL_shaders_d3d11.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d11/SDL_shaders_d3d11.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/direct3d12/SDL_render_d3d12.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d12/SDL_render_d3d12.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d12/SDL_render_d3d12.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/direct3d12/SDL_shaders_d3d12.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/direct3d12/SDL_shaders_d3d12.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/opengl/SDL_render_gl.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengl/SDL_render_gl.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengl/SDL_render_gl.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/opengl/SDL_shaders_gl.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengl/SDL_shaders_gl.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengl/SDL_shaders_gl.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/opengles/SDL_render_gles.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengles/SDL_render_gles.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengles/SDL_render_gles.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/opengles2/SDL_render_gles2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengles2/SDL_render_gles2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengles2/SDL_render_gles2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/opengles2/SDL_shaders_gles2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengles2/SDL_shaders_gles2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/opengles2/SDL_shaders_gles2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/ps2/SDL_render_ps2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/ps2/SDL_render_ps2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/ps2/SDL_render_ps2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/psp/SDL_render_psp.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/psp/SDL_render_psp.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/psp/SDL_render_psp.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_blendfillrect.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_blendfillrect.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_blendfillrect.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_blendline.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_blendline.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_blendline.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_blendpoint.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_blendpoint.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_blendpoint.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_drawline.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_drawline.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_drawline.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_drawpoint.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_drawpoint.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_drawpoint.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_render_sw.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_render_sw.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_render_sw.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_rotate.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_rotate.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_rotate.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/software/SDL_triangle.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_triangle.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/software/SDL_triangle.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/vitagxm/SDL_render_vita_gxm.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/vitagxm/SDL_render_vita_gxm.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/vitagxm/SDL_render_vita_gxm_memory.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/vitagxm/SDL_render_vita_gxm_memory.c.o.d"
+  "/root/repo/dependencies/SDL2/src/render/vitagxm/SDL_render_vita_gxm_tools.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/render/vitagxm/SDL_render_vita_gxm_tools.c.o.d"
+  "/root/repo/dependencies/SDL2/src/sensor/SDL_sensor.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/sensor/SDL_sensor.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/sensor/SDL_sensor.c.o.d"
+  "/root/repo/dependencies/SDL2/src/sensor/dummy/SDL_dummysensor.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/sensor/dummy/SDL_dummysensor.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/sensor/dummy/SDL_dummysensor.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_crc16.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_crc16.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_crc16.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_crc32.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_crc32.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_crc32.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_getenv.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_getenv.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_getenv.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_iconv.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_iconv.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_iconv.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_malloc.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_malloc.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_malloc.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_mslibc.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_mslibc.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_mslibc.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_qsort.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_qsort.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_qsort.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_stdlib.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_stdlib.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_string.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_string.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_string.c.o.d"
+  "/root/repo/dependencies/SDL2/src/stdlib/SDL_strtokr.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_strtokr.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/stdlib/SDL_strtokr.c.o.d"
+  "/root/repo/dependencies/SDL2/src/thread/SDL_thread.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/SDL_thread.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/SDL_thread.c.o.d"
+  "/root/repo/dependencies/SDL2/src/thread/pthread/SDL_syscond.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_syscond.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "/root/repo/dependencies/SDL2/src/thread/pthread/SDL_sysmutex.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_sysmutex.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "/root/repo/dependencies/SDL2/src/thread/pthread/SDL_syssem.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_syssem.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "/root/repo/dependencies/SDL2/src/thread/pthread/SDL_systhread.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_systhread.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "/root/repo/dependencies/SDL2/src/thread/pthread/SDL_systls.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_systls.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "/root/repo/dependencies/SDL2/src/timer/SDL_timer.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/timer/SDL_timer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/timer/SDL_timer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/timer/unix/SDL_systimer.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/timer/unix/SDL_systimer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_RLEaccel.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_RLEaccel.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_RLEaccel.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_0.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_0.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_0.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_1.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_1.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_1.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_A.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_A.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_A.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_N.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_N.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_N.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_auto.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_auto.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_auto.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_copy.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_copy.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_copy.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_blit_slow.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_slow.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_blit_slow.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_bmp.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_bmp.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_bmp.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_clipboard.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_clipboard.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_clipboard.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_egl.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_egl.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_egl.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_fillrect.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_fillrect.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_fillrect.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_pixels.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_pixels.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_pixels.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_rect.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_rect.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_rect.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_shape.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_shape.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_shape.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_stretch.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_stretch.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_stretch.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_surface.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_surface.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_surface.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_video.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_video.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_video.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_vulkan_utils.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_vulkan_utils.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_vulkan_utils.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/SDL_yuv.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_yuv.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/SDL_yuv.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/dummy/SDL_nullevents.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/dummy/SDL_nullevents.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/dummy/SDL_nullframebuffer.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/dummy/SDL_nullframebuffer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/dummy/SDL_nullvideo.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/dummy/SDL_nullvideo.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/offscreen/SDL_offscreenevents.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenevents.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenevents.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/offscreen/SDL_offscreenframebuffer.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenframebuffer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/offscreen/SDL_offscreenopengles.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenopengles.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenopengles.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/offscreen/SDL_offscreenvideo.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenvideo.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenvideo.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/offscreen/SDL_offscreenwindow.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenwindow.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/offscreen/SDL_offscreenwindow.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11clipboard.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11clipboard.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11dyn.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11dyn.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11events.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11events.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11events.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11framebuffer.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11framebuffer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11keyboard.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11keyboard.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11messagebox.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11messagebox.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11modes.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11modes.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11mouse.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11mouse.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11opengl.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11opengl.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11opengles.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11opengles.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11shape.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11shape.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11touch.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11touch.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11video.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11video.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11video.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11vulkan.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11vulkan.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11vulkan.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11window.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11window.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11window.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11xfixes.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11xfixes.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11xfixes.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/SDL_x11xinput2.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11xinput2.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/x11/edid-parse.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/edid-parse.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/x11/edid-parse.c.o.d"
+  "/root/repo/dependencies/SDL2/src/video/yuv2rgb/yuv_rgb.c" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/yuv2rgb/yuv_rgb.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2-static.dir/src/video/yuv2rgb/yuv_rgb.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
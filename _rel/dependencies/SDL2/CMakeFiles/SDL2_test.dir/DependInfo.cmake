@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_assert.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_assert.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_assert.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_common.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_common.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_common.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_compare.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_compare.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_compare.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_crc32.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_crc32.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_crc32.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_font.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_font.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_font.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_fuzzer.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_fuzzer.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_fuzzer.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_harness.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_harness.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_harness.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_imageBlit.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlit.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlit.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_imageBlitBlend.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlitBlend.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlitBlend.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_imageFace.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageFace.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageFace.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_imagePrimitives.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitives.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitives.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_imagePrimitivesBlend.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitivesBlend.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitivesBlend.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_log.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_log.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_log.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_md5.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_md5.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_md5.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_memory.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_memory.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_memory.c.o.d"
+  "/root/repo/dependencies/SDL2/src/test/SDL_test_random.c" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_random.c.o" "gcc" "dependencies/SDL2/CMakeFiles/SDL2_test.dir/src/test/SDL_test_random.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_assert.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_assert.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_common.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_common.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_compare.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_compare.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_crc32.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_crc32.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_font.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_font.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_fuzzer.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_fuzzer.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_harness.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_harness.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlit.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlit.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlitBlend.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageBlitBlend.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageFace.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imageFace.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitives.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitives.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitivesBlend.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_imagePrimitivesBlend.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_log.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_log.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_md5.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_md5.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_memory.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_memory.c.o.d"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_random.c.o"
+  "CMakeFiles/SDL2_test.dir/src/test/SDL_test_random.c.o.d"
+  "libSDL2_test.a"
+  "libSDL2_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/SDL2_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+/* #undef SDL_VENDOR_INFO */
+#define SDL_REVISION_NUMBER 0
+
+#ifdef SDL_VENDOR_INFO
+#define SDL_REVISION "SDL-2.26.2-g4e914d8 (" SDL_VENDOR_INFO ")"
+#else
+#define SDL_REVISION "SDL-2.26.2-g4e914d8"
+#endif
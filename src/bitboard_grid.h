@@ -0,0 +1,436 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+
+#include "life_engine.h"
+#include "bitboard_kernels.h"
+#include "thread_pool.h"
+
+// Universe stored as 64 cells per uint64_t. Every row is padded with one
+// ghost word on the left and right and the grid has one ghost row on top and
+// bottom, so the step kernel reads neighbours without any bounds checks. With
+// a dead boundary the ghost cells stay dead; other boundaries refill the
+// cells next to the grid at the start of every step (fill_bitboard_halo).
+//
+// The grid is also split into tiles of 64 x 64 cells (64 rows of one word). A
+// tile is only recomputed if it or one of its eight neighbour tiles changed
+// in the previous generation; otherwise both buffers already hold the same
+// contents for it and the tile is skipped.
+//
+// Every tile also records whether it holds a live cell, which gives the box
+// of live tiles. With a dead boundary and a rule without B0 nothing can
+// happen more than one tile away from a live or changed tile, so only that
+// box plus one tile is scheduled at all, and get_live_bounds() narrows the
+// box of live tiles down to cells.
+//
+// Only active tiles are scheduled: they are grouped into runs of up to
+// MAX_RUN_TILES adjacent tiles of one tile row, and the runs are handed to a
+// persistent thread pool whose idle workers steal runs from busy ones. A run
+// only writes its own words of the next buffer and reads its halo from the
+// current one, so runs never conflict.
+class BitboardGrid : public LifeEngine {
+public:
+	static const int TILE_ROWS = 64;
+	static const int MAX_RUN_TILES = 32;
+
+	BitboardGrid(int rows1, int columns1) {
+		rows = rows1;
+		columns = columns1;
+
+		data_words = (columns + 63) / 64;
+		// Round the stride up so every row starts on a SIMD-aligned boundary.
+		int words_per_vector = (int)(SDL_SIMDGetAlignment() / sizeof(uint64_t));
+		if (words_per_vector < 1) {
+			words_per_vector = 1;
+		}
+		words_per_row = (data_words + 2 + words_per_vector - 1) / words_per_vector * words_per_vector;
+
+		int remaining_bits = columns % 64;
+		last_word_mask = remaining_bits == 0 ? ~uint64_t(0) : (uint64_t(1) << remaining_bits) - 1;
+
+		size_t bytes = (size_t)words_per_row * (rows + 2) * sizeof(uint64_t);
+		current = (uint64_t*)SDL_SIMDAlloc(bytes);
+		next = (uint64_t*)SDL_SIMDAlloc(bytes);
+		SDL_memset(current, 0, bytes);
+		SDL_memset(next, 0, bytes);
+
+		tile_rows = (rows + TILE_ROWS - 1) / TILE_ROWS;
+		tile_columns = data_words;
+		// Everything counts as changed until the first step has looked at it.
+		tile_changed.assign((size_t)tile_rows * tile_columns, 1);
+		next_tile_changed.assign((size_t)tile_rows * tile_columns, 0);
+		tile_occupied.assign((size_t)tile_rows * tile_columns, 0);
+		next_tile_occupied.assign((size_t)tile_rows * tile_columns, 0);
+		live_tiles = { tile_rows, tile_columns, 0, 0 };
+		active_tiles = all_tiles();
+		tiles_skipped = 0;
+		boundary = Boundary::Dead;
+
+		row_kernel = select_bitboard_row_kernel(rule.life_rule);
+		std::cout << "Bitboard engine using the " << bitboard_row_kernel_name(row_kernel) << " kernel." << std::endl;
+
+		set_thread_count((int)std::thread::hardware_concurrency());
+	}
+
+	~BitboardGrid() {
+		SDL_SIMDFree(current);
+		SDL_SIMDFree(next);
+	}
+
+	BitboardGrid(const BitboardGrid&) = delete;
+	BitboardGrid& operator=(const BitboardGrid&) = delete;
+
+	void step() override {
+		if (boundary != Boundary::Dead) {
+			fill_bitboard_halo(current, words_per_row, rows, columns, boundary);
+		}
+		schedule_active_runs();
+		thread_pool->parallel_for_stealing((int)runs.size(), [this](int i, int worker) {
+			step_run(runs[i]);
+			thread_pool->record_work(worker, runs[i].tile_count);
+		});
+		std::swap(current, next);
+		tile_changed.swap(next_tile_changed);
+		tile_occupied.swap(next_tile_occupied);
+		update_tile_boxes();
+	}
+
+	// Number of threads stepping the tiles, including the calling thread.
+	void set_thread_count(int thread_count) {
+		thread_pool = std::make_unique<ThreadPool>(thread_count);
+	}
+
+	// Per worker since the last reset: runs of tiles stepped
+	// (tasks_processed), tiles stepped (work_units) and steals.
+	std::vector<WorkerStats>& get_worker_stats() {
+		return thread_pool->get_worker_stats();
+	}
+
+	// The tiles the last step skipped, and the worker stats since the last
+	// call, which then start counting again.
+	std::string describe_stats() override {
+		std::string text = "Tiles skipped: ";
+		text += std::to_string((int)(skipped_tile_fraction() * 100 + 0.5));
+		text += "%, runs/tiles/steals per worker:";
+		for (WorkerStats& stats : get_worker_stats()) {
+			text += " ";
+			text += std::to_string(stats.tasks_processed);
+			text += "/";
+			text += std::to_string(stats.work_units);
+			text += "/";
+			text += std::to_string(stats.steals);
+		}
+		thread_pool->reset_worker_stats();
+		return text;
+	}
+
+	bool is_alive(int r, int c) override {
+		return (current[word_index(r, c)] >> (c % 64)) & 1;
+	}
+
+	void set_alive(int r, int c, bool alive) override {
+		uint64_t bit = uint64_t(1) << (c % 64);
+		if (alive) {
+			current[word_index(r, c)] |= bit;
+		} else {
+			current[word_index(r, c)] &= ~bit;
+		}
+		int tr = r / TILE_ROWS;
+		int tc = c / 64;
+		tile_changed[(size_t)tr * tile_columns + tc] = 1;
+		include_tile(active_tiles, tr, tc);
+		// A tile that loses a cell keeps counting as occupied until the next
+		// step recomputes it.
+		if (alive) {
+			tile_occupied[(size_t)tr * tile_columns + tc] = 1;
+			include_tile(live_tiles, tr, tc);
+		}
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		for (int dr = 0; dr < height; dr++) {
+			const uint64_t* row = &current[(size_t)(r + dr + 1) * words_per_row + 1];
+			uint8_t* out_row = &out[(size_t)dr * width];
+			// A word at a time, the inner loop vectorizes.
+			int dc = 0;
+			while (dc < width) {
+				int column = c + dc;
+				uint64_t word = row[column / 64] >> (column % 64);
+				int count = std::min(64 - column % 64, width - dc);
+				for (int i = 0; i < count; i++) {
+					out_row[dc + i] = (word >> i) & 1;
+				}
+				dc += count;
+			}
+		}
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	bool set_rule(LifeRule rule1) override {
+		if (rule1.is_generations()) {
+			std::cout << "Bitboard cannot run " << rule1.to_string() << ", Generations rules need the Generations engine." << std::endl;
+			return false;
+		}
+		rule = BitboardRule(rule1);
+		row_kernel = select_bitboard_row_kernel(rule1);
+		// Tiles that were stable under the old rule may not be under the new one.
+		std::fill(tile_changed.begin(), tile_changed.end(), 1);
+		active_tiles = all_tiles();
+		return true;
+	}
+
+	LifeRule get_rule() override {
+		return rule.life_rule;
+	}
+
+	bool set_boundary(Boundary boundary1) override {
+		boundary = boundary1;
+		// In both buffers, so a dead boundary leaves no old halo cells behind.
+		fill_bitboard_halo(current, words_per_row, rows, columns, boundary);
+		fill_bitboard_halo(next, words_per_row, rows, columns, boundary);
+		std::fill(tile_changed.begin(), tile_changed.end(), 1);
+		active_tiles = all_tiles();
+		return true;
+	}
+
+	Boundary get_boundary() override {
+		return boundary;
+	}
+
+	// The box of live tiles narrowed down to the rows and columns that hold
+	// live cells.
+	CellBox get_live_bounds() override {
+		if (live_tiles.is_empty()) {
+			return { 0, 0, 0, 0 };
+		}
+		int first_word = live_tiles.left + 1;
+		int last_word = live_tiles.right;
+		int top = live_tiles.top * TILE_ROWS;
+		int bottom = std::min(live_tiles.bottom * TILE_ROWS, rows);
+		while (top < bottom && !row_has_live_cells(top, first_word, last_word)) {
+			top++;
+		}
+		if (top == bottom) {
+			return { 0, 0, 0, 0 };
+		}
+		while (!row_has_live_cells(bottom - 1, first_word, last_word)) {
+			bottom--;
+		}
+		while (column_word_bits(first_word, top, bottom) == 0) {
+			first_word++;
+		}
+		while (column_word_bits(last_word, top, bottom) == 0) {
+			last_word--;
+		}
+		int left = (first_word - 1) * 64 + std::countr_zero(column_word_bits(first_word, top, bottom));
+		int right = last_word * 64 - std::countl_zero(column_word_bits(last_word, top, bottom));
+		return { top, left, bottom, right };
+	}
+
+	uint64_t count_live_cells() override {
+		CellBox bounds = get_live_bounds();
+		uint64_t count = 0;
+		for (int r = bounds.top; r < bounds.bottom; r++) {
+			for (int w = bounds.left / 64 + 1; w <= (bounds.right - 1) / 64 + 1; w++) {
+				count += std::popcount(data_word(r, w));
+			}
+		}
+		return count;
+	}
+
+	// Fraction of tiles the last step did not have to recompute.
+	double skipped_tile_fraction() {
+		return (double)tiles_skipped / ((size_t)tile_rows * tile_columns);
+	}
+
+	// Index of the word holding cell (r, c), skipping the ghost row and word.
+	size_t word_index(int r, int c) {
+		return (size_t)(r + 1) * words_per_row + 1 + c / 64;
+	}
+
+	int rows;
+	int columns;
+
+	int data_words;
+	int words_per_row;
+	uint64_t last_word_mask;
+
+	// Allocated with SDL_SIMDAlloc, swapped after every step.
+	uint64_t* current;
+	uint64_t* next;
+
+	BitboardRule rule;
+	// Specialized for Conway when the rule is B3/S23.
+	BitboardRowKernel row_kernel;
+	Boundary boundary;
+
+	int tile_rows;
+	int tile_columns;
+	// One byte per tile: did the tile change in the last generation.
+	std::vector<uint8_t> tile_changed;
+	std::vector<uint8_t> next_tile_changed;
+	// One byte per tile: does the tile hold a live cell.
+	std::vector<uint8_t> tile_occupied;
+	std::vector<uint8_t> next_tile_occupied;
+	// In tile rows and columns: the tiles holding live cells, and the tiles
+	// that hold live cells or changed in the last generation.
+	CellBox live_tiles;
+	CellBox active_tiles;
+	size_t tiles_skipped;
+
+	std::unique_ptr<ThreadPool> thread_pool;
+
+private:
+	// Adjacent active tiles of one tile row, stepped as a single task.
+	struct TileRun {
+		int tile_row;
+		int first_tile;
+		int tile_count;
+	};
+
+	// Marks the tiles whose neighbourhood changed and splits them into runs.
+	// Skipped tiles keep their occupancy, the runs recompute theirs.
+	void schedule_active_runs() {
+		runs.clear();
+		tiles_skipped = (size_t)tile_rows * tile_columns;
+		std::fill(next_tile_changed.begin(), next_tile_changed.end(), 0);
+		std::copy(tile_occupied.begin(), tile_occupied.end(), next_tile_occupied.begin());
+		CellBox scheduled = all_tiles();
+		if (boundary == Boundary::Dead && !rule.life_rule.next_state_of(0)) {
+			scheduled = active_tiles.expanded(1, tile_rows, tile_columns);
+		}
+		for (int tr = scheduled.top; tr < scheduled.bottom; tr++) {
+			int tc = scheduled.left;
+			while (tc < scheduled.right) {
+				if (!neighbourhood_changed(tr, tc)) {
+					tc++;
+					continue;
+				}
+				int run_start = tc;
+				while (tc < scheduled.right && tc - run_start < MAX_RUN_TILES && neighbourhood_changed(tr, tc)) {
+					tc++;
+				}
+				runs.push_back(TileRun{ tr, run_start, tc - run_start });
+				tiles_skipped -= tc - run_start;
+				std::fill_n(&next_tile_occupied[(size_t)tr * tile_columns + run_start], tc - run_start, 0);
+			}
+		}
+	}
+
+	CellBox all_tiles() {
+		return { 0, 0, tile_rows, tile_columns };
+	}
+
+	static void include_tile(CellBox& box, int tr, int tc) {
+		box = { std::min(box.top, tr), std::min(box.left, tc), std::max(box.bottom, tr + 1), std::max(box.right, tc + 1) };
+	}
+
+	void update_tile_boxes() {
+		live_tiles = { tile_rows, tile_columns, 0, 0 };
+		active_tiles = live_tiles;
+		for (int tr = 0; tr < tile_rows; tr++) {
+			for (int tc = 0; tc < tile_columns; tc++) {
+				size_t tile = (size_t)tr * tile_columns + tc;
+				if (tile_occupied[tile]) {
+					include_tile(live_tiles, tr, tc);
+				}
+				if (tile_occupied[tile] || tile_changed[tile]) {
+					include_tile(active_tiles, tr, tc);
+				}
+			}
+		}
+	}
+
+	// Word w of grid row r without the halo cell past the last column.
+	uint64_t data_word(int r, int w) {
+		uint64_t word = current[(size_t)(r + 1) * words_per_row + w];
+		return w == data_words ? word & last_word_mask : word;
+	}
+
+	bool row_has_live_cells(int r, int first_word, int last_word) {
+		for (int w = first_word; w <= last_word; w++) {
+			if (data_word(r, w)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Columns of word w holding a live cell in rows top..bottom - 1.
+	uint64_t column_word_bits(int w, int top, int bottom) {
+		uint64_t bits = 0;
+		for (int r = top; r < bottom; r++) {
+			bits |= data_word(r, w);
+		}
+		return bits;
+	}
+
+	// Steps the 64 rows of a run and records which of its tiles changed.
+	void step_run(const TileRun& run) {
+		int first_row = run.tile_row * TILE_ROWS + 1;
+		int last_row = first_row + TILE_ROWS - 1 < rows ? first_row + TILE_ROWS - 1 : rows;
+		size_t first_tile = (size_t)run.tile_row * tile_columns + run.first_tile;
+		step_words(first_row, last_row, run.first_tile + 1, run.tile_count, &next_tile_changed[first_tile], &next_tile_occupied[first_tile]);
+	}
+
+	// Steps words first_word..first_word + word_count - 1 of the padded rows
+	// first_row..last_row and records which of those words changed and which
+	// hold live cells.
+	void step_words(int first_row, int last_row, int first_word, int word_count, uint8_t* changed_out, uint8_t* occupied_out) {
+		for (int r = first_row; r <= last_row; r++) {
+			const uint64_t* above = &current[(size_t)(r - 1) * words_per_row];
+			const uint64_t* middle = &current[(size_t)r * words_per_row];
+			const uint64_t* below = &current[(size_t)(r + 1) * words_per_row];
+			uint64_t* out = &next[(size_t)r * words_per_row];
+
+			row_kernel(above + first_word - 1, middle + first_word - 1, below + first_word - 1, out + first_word - 1, word_count, rule);
+			if (first_word + word_count - 1 == data_words) {
+				// Bits past the last column would otherwise come alive next to the border.
+				out[data_words] &= last_word_mask;
+			}
+			for (int i = 0; i < word_count; i++) {
+				// The old word without its halo bit, like the masked output.
+				changed_out[i] |= out[first_word + i] != data_word(r - 1, first_word + i);
+				occupied_out[i] |= out[first_word + i] != 0;
+			}
+		}
+	}
+
+	bool neighbourhood_changed(int tr, int tc) {
+		// Across a wrapped edge a tile's halo comes from the far side of the
+		// grid, so tiles on the edge are always recomputed.
+		if (boundary != Boundary::Dead && (tr == 0 || tc == 0 || tr == tile_rows - 1 || tc == tile_columns - 1)) {
+			return true;
+		}
+		for (int dr = -1; dr <= 1; dr++) {
+			for (int dc = -1; dc <= 1; dc++) {
+				int n_tr = tr + dr;
+				int n_tc = tc + dc;
+				if (n_tr < 0 || n_tr >= tile_rows || n_tc < 0 || n_tc >= tile_columns) continue;
+				if (tile_changed[(size_t)n_tr * tile_columns + n_tc]) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	// Scratch space, kept around so a step does not allocate.
+	std::vector<TileRun> runs;
+};
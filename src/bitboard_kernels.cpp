@@ -0,0 +1,459 @@
+#include "bitboard_kernels.h"
+
+#include <algorithm>
+
+#include <SDL.h>
+
+// Every kernel comes in two versions: Conway hard-wires B3/S23 and ignores the
+// rule argument, the other runs any outer-totalistic rule. The general
+// kernels evaluate the survive and birth masks as truth tables over the
+// (fours, twos, ones) planes and pick between them by the cell's state: the
+// AVX-512 kernel with ternary logic instructions, the scalar and AVX2 kernels
+// with code instantiated for each of the 256 tables.
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BITBOARD_HAS_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+// GCC and Clang only emit AVX instructions inside functions that opt in, MSVC
+// emits them anywhere. This lets the file be built without -mavx2 so the
+// binary still runs on older CPUs.
+#if defined(__GNUC__) || defined(__clang__)
+#define BITBOARD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BITBOARD_TARGET(isa)
+#endif
+
+// All 64 bits set if bit Count of Table is.
+template <int Table, int Count>
+static inline uint64_t table_bits() {
+	return (Table >> Count) & 1 ? ~uint64_t(0) : 0;
+}
+
+// mask ? a : b, bit by bit.
+static inline uint64_t select_bits(uint64_t mask, uint64_t a, uint64_t b) {
+	return b ^ (mask & (a ^ b));
+}
+
+// Bit n of Table for every cell, n = ones + 2 * twos + 4 * fours. Written as
+// a tree of selects on constants, so for a given table the compiler folds it
+// down to a few instructions.
+template <int Table>
+static inline uint64_t count_table(uint64_t ones, uint64_t twos, uint64_t fours) {
+	uint64_t count_0_1 = select_bits(ones, table_bits<Table, 1>(), table_bits<Table, 0>());
+	uint64_t count_2_3 = select_bits(ones, table_bits<Table, 3>(), table_bits<Table, 2>());
+	uint64_t count_4_5 = select_bits(ones, table_bits<Table, 5>(), table_bits<Table, 4>());
+	uint64_t count_6_7 = select_bits(ones, table_bits<Table, 7>(), table_bits<Table, 6>());
+	return select_bits(fours, select_bits(twos, count_6_7, count_4_5), select_bits(twos, count_2_3, count_0_1));
+}
+
+// The scalar kernel evaluates a batch of words at a time: the count planes
+// of the batch go into a buffer and the tables run over the whole batch, so
+// the jump to the table's code is paid once per batch and the loops stay
+// simple enough for the compiler to vectorize.
+static const int RULE_BATCH = 16;
+
+struct CountPlanesBatch {
+	uint64_t ones[RULE_BATCH];
+	uint64_t twos[RULE_BATCH];
+	uint64_t fours[RULE_BATCH];
+	uint64_t eights[RULE_BATCH];
+};
+
+// A table's result for a batch.
+struct TableBatch {
+	uint64_t bits[RULE_BATCH];
+};
+
+#define COUNT_TABLE_BATCH_CASE(n) case n: for (int i = 0; i < RULE_BATCH; i++) out.bits[i] = count_table<n>(planes.ones[i], planes.twos[i], planes.fours[i]); return;
+#define COUNT_TABLE_BATCH_CASES_4(n) COUNT_TABLE_BATCH_CASE(n) COUNT_TABLE_BATCH_CASE(n + 1) COUNT_TABLE_BATCH_CASE(n + 2) COUNT_TABLE_BATCH_CASE(n + 3)
+#define COUNT_TABLE_BATCH_CASES_16(n) COUNT_TABLE_BATCH_CASES_4(n) COUNT_TABLE_BATCH_CASES_4(n + 4) COUNT_TABLE_BATCH_CASES_4(n + 8) COUNT_TABLE_BATCH_CASES_4(n + 12)
+#define COUNT_TABLE_BATCH_CASES_64(n) COUNT_TABLE_BATCH_CASES_16(n) COUNT_TABLE_BATCH_CASES_16(n + 16) COUNT_TABLE_BATCH_CASES_16(n + 32) COUNT_TABLE_BATCH_CASES_16(n + 48)
+
+// __restrict because the result never overlaps the planes, without it every
+// case gets a second copy of its loop for when they do.
+static void count_table_batch(const CountPlanesBatch& __restrict planes, TableBatch& __restrict out, int table) {
+	switch (table) {
+		COUNT_TABLE_BATCH_CASES_64(0)
+		COUNT_TABLE_BATCH_CASES_64(64)
+		COUNT_TABLE_BATCH_CASES_64(128)
+		COUNT_TABLE_BATCH_CASES_64(192)
+	}
+}
+
+// The survive and birth masks as truth tables for count_table and as
+// all-ones/zero words for whether 8 neighbours, which read as 0 in the
+// planes, have to be flipped.
+struct CountTables {
+	int survive_table;
+	int birth_table;
+	uint64_t survive_flips;
+	uint64_t birth_flips;
+
+	CountTables(const LifeRule& rule) {
+		survive_table = rule.survive_mask & 0xFF;
+		birth_table = rule.birth_mask & 0xFF;
+		survive_flips = ((rule.survive_mask >> 8) ^ rule.survive_mask) & 1 ? ~uint64_t(0) : 0;
+		birth_flips = ((rule.birth_mask >> 8) ^ rule.birth_mask) & 1 ? ~uint64_t(0) : 0;
+	}
+};
+
+template <bool Conway>
+static void bitboard_row_kernel_scalar(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule) {
+	if constexpr (Conway) {
+		for (int w = 1; w <= data_words; w++) {
+			NeighbourCountPlanes planes = count_neighbours(
+				above[w - 1], above[w], above[w + 1],
+				middle[w - 1], middle[w], middle[w + 1],
+				below[w - 1], below[w], below[w + 1]);
+			out[w] = conway_rule(middle[w], planes);
+		}
+	} else {
+		CountTables tables(rule.life_rule);
+		CountPlanesBatch planes_batch;
+		TableBatch survive;
+		TableBatch birth;
+		for (int w = 1; w <= data_words; w += RULE_BATCH) {
+			int words = std::min(RULE_BATCH, data_words - w + 1);
+			for (int i = 0; i < words; i++) {
+				int x = w + i;
+				NeighbourCountPlanes planes = count_neighbours(
+					above[x - 1], above[x], above[x + 1],
+					middle[x - 1], middle[x], middle[x + 1],
+					below[x - 1], below[x], below[x + 1]);
+				planes_batch.ones[i] = planes.ones;
+				planes_batch.twos[i] = planes.twos;
+				planes_batch.fours[i] = planes.fours;
+				planes_batch.eights[i] = planes.eights;
+			}
+			// The tables always run over a whole batch.
+			for (int i = words; i < RULE_BATCH; i++) {
+				planes_batch.ones[i] = 0;
+				planes_batch.twos[i] = 0;
+				planes_batch.fours[i] = 0;
+			}
+			count_table_batch(planes_batch, survive, tables.survive_table);
+			count_table_batch(planes_batch, birth, tables.birth_table);
+			for (int i = 0; i < words; i++) {
+				uint64_t alive = middle[w + i];
+				uint64_t flip = planes_batch.eights[i] & select_bits(alive, tables.survive_flips, tables.birth_flips);
+				out[w + i] = select_bits(alive, survive.bits[i], birth.bits[i]) ^ flip;
+			}
+		}
+	}
+}
+
+#ifdef BITBOARD_HAS_X86_KERNELS
+
+struct NeighbourCountPlanes256 {
+	__m256i ones;
+	__m256i twos;
+	__m256i fours;
+	__m256i eights;
+};
+
+BITBOARD_TARGET("avx2")
+static inline void count_neighbours_avx2(const uint64_t* above, const uint64_t* middle, const uint64_t* below, int w, NeighbourCountPlanes256& planes) {
+	__m256i a = _mm256_loadu_si256((const __m256i*)&above[w]);
+	__m256i m = _mm256_loadu_si256((const __m256i*)&middle[w]);
+	__m256i b = _mm256_loadu_si256((const __m256i*)&below[w]);
+
+	__m256i a_w = _mm256_or_si256(_mm256_slli_epi64(a, 1), _mm256_srli_epi64(_mm256_loadu_si256((const __m256i*)&above[w - 1]), 63));
+	__m256i a_e = _mm256_or_si256(_mm256_srli_epi64(a, 1), _mm256_slli_epi64(_mm256_loadu_si256((const __m256i*)&above[w + 1]), 63));
+	__m256i m_w = _mm256_or_si256(_mm256_slli_epi64(m, 1), _mm256_srli_epi64(_mm256_loadu_si256((const __m256i*)&middle[w - 1]), 63));
+	__m256i m_e = _mm256_or_si256(_mm256_srli_epi64(m, 1), _mm256_slli_epi64(_mm256_loadu_si256((const __m256i*)&middle[w + 1]), 63));
+	__m256i b_w = _mm256_or_si256(_mm256_slli_epi64(b, 1), _mm256_srli_epi64(_mm256_loadu_si256((const __m256i*)&below[w - 1]), 63));
+	__m256i b_e = _mm256_or_si256(_mm256_srli_epi64(b, 1), _mm256_slli_epi64(_mm256_loadu_si256((const __m256i*)&below[w + 1]), 63));
+
+	__m256i a_xor = _mm256_xor_si256(a_w, a);
+	__m256i a_sum = _mm256_xor_si256(a_xor, a_e);
+	__m256i a_carry = _mm256_or_si256(_mm256_and_si256(a_w, a), _mm256_and_si256(a_xor, a_e));
+
+	__m256i m_sum = _mm256_xor_si256(m_w, m_e);
+	__m256i m_carry = _mm256_and_si256(m_w, m_e);
+
+	__m256i b_xor = _mm256_xor_si256(b_w, b);
+	__m256i b_sum = _mm256_xor_si256(b_xor, b_e);
+	__m256i b_carry = _mm256_or_si256(_mm256_and_si256(b_w, b), _mm256_and_si256(b_xor, b_e));
+
+	__m256i s_xor = _mm256_xor_si256(a_sum, m_sum);
+	__m256i ones_carry = _mm256_or_si256(_mm256_and_si256(a_sum, m_sum), _mm256_and_si256(s_xor, b_sum));
+
+	__m256i x = _mm256_xor_si256(a_carry, m_carry);
+	__m256i y = _mm256_xor_si256(b_carry, ones_carry);
+	__m256i pair_a = _mm256_and_si256(a_carry, m_carry);
+	__m256i pair_b = _mm256_and_si256(b_carry, ones_carry);
+	__m256i pair_xy = _mm256_and_si256(x, y);
+
+	planes.ones = _mm256_xor_si256(s_xor, b_sum);
+	planes.twos = _mm256_xor_si256(x, y);
+	planes.fours = _mm256_xor_si256(_mm256_xor_si256(pair_a, pair_b), pair_xy);
+	planes.eights = _mm256_and_si256(pair_a, pair_b);
+}
+
+BITBOARD_TARGET("avx2")
+static inline __m256i select_bits_avx2(__m256i mask, __m256i a, __m256i b) {
+	return _mm256_xor_si256(b, _mm256_and_si256(mask, _mm256_xor_si256(a, b)));
+}
+
+template <int Table, int Count>
+BITBOARD_TARGET("avx2")
+static inline __m256i table_bits_avx2() {
+	return (Table >> Count) & 1 ? _mm256_set1_epi64x(-1) : _mm256_setzero_si256();
+}
+
+// count_table on four words.
+template <int Table>
+BITBOARD_TARGET("avx2")
+static inline __m256i count_table_avx2(__m256i ones, __m256i twos, __m256i fours) {
+	__m256i count_0_1 = select_bits_avx2(ones, table_bits_avx2<Table, 1>(), table_bits_avx2<Table, 0>());
+	__m256i count_2_3 = select_bits_avx2(ones, table_bits_avx2<Table, 3>(), table_bits_avx2<Table, 2>());
+	__m256i count_4_5 = select_bits_avx2(ones, table_bits_avx2<Table, 5>(), table_bits_avx2<Table, 4>());
+	__m256i count_6_7 = select_bits_avx2(ones, table_bits_avx2<Table, 7>(), table_bits_avx2<Table, 6>());
+	return select_bits_avx2(fours, select_bits_avx2(twos, count_6_7, count_4_5), select_bits_avx2(twos, count_2_3, count_0_1));
+}
+
+// Jumps to the code for a table known at run time. The table is the same for
+// a whole row, so the jump is always predicted and the planes stay in
+// registers.
+#define COUNT_TABLE_AVX2_CASE(n) case n: return count_table_avx2<n>(ones, twos, fours);
+#define COUNT_TABLE_AVX2_CASES_4(n) COUNT_TABLE_AVX2_CASE(n) COUNT_TABLE_AVX2_CASE(n + 1) COUNT_TABLE_AVX2_CASE(n + 2) COUNT_TABLE_AVX2_CASE(n + 3)
+#define COUNT_TABLE_AVX2_CASES_16(n) COUNT_TABLE_AVX2_CASES_4(n) COUNT_TABLE_AVX2_CASES_4(n + 4) COUNT_TABLE_AVX2_CASES_4(n + 8) COUNT_TABLE_AVX2_CASES_4(n + 12)
+#define COUNT_TABLE_AVX2_CASES_64(n) COUNT_TABLE_AVX2_CASES_16(n) COUNT_TABLE_AVX2_CASES_16(n + 16) COUNT_TABLE_AVX2_CASES_16(n + 32) COUNT_TABLE_AVX2_CASES_16(n + 48)
+
+BITBOARD_TARGET("avx2")
+static inline __m256i count_table_avx2(__m256i ones, __m256i twos, __m256i fours, int table) {
+	switch (table) {
+		COUNT_TABLE_AVX2_CASES_64(0)
+		COUNT_TABLE_AVX2_CASES_64(64)
+		COUNT_TABLE_AVX2_CASES_64(128)
+		COUNT_TABLE_AVX2_CASES_64(192)
+	}
+	return ones;
+}
+
+template <bool Conway>
+BITBOARD_TARGET("avx2")
+static void bitboard_row_kernel_avx2(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule) {
+	int w = 1;
+	if constexpr (Conway) {
+		for (; w + 3 <= data_words; w += 4) {
+			NeighbourCountPlanes256 planes;
+			count_neighbours_avx2(above, middle, below, w, planes);
+			__m256i m = _mm256_loadu_si256((const __m256i*)&middle[w]);
+			// fours | eights: the count is at least 4.
+			__m256i at_least_four = _mm256_or_si256(planes.fours, planes.eights);
+			__m256i result = _mm256_andnot_si256(at_least_four, _mm256_and_si256(planes.twos, _mm256_or_si256(planes.ones, m)));
+			_mm256_storeu_si256((__m256i*)&out[w], result);
+		}
+	} else {
+		CountTables tables(rule.life_rule);
+		bool flips = (tables.survive_flips | tables.birth_flips) != 0;
+		__m256i survive_flips = _mm256_set1_epi64x((int64_t)tables.survive_flips);
+		__m256i birth_flips = _mm256_set1_epi64x((int64_t)tables.birth_flips);
+		for (; w + 3 <= data_words; w += 4) {
+			NeighbourCountPlanes256 planes;
+			count_neighbours_avx2(above, middle, below, w, planes);
+			__m256i m = _mm256_loadu_si256((const __m256i*)&middle[w]);
+			__m256i survive = count_table_avx2(planes.ones, planes.twos, planes.fours, tables.survive_table);
+			__m256i birth = count_table_avx2(planes.ones, planes.twos, planes.fours, tables.birth_table);
+			__m256i result = select_bits_avx2(m, survive, birth);
+			if (flips) {
+				__m256i flip = select_bits_avx2(m, survive_flips, birth_flips);
+				result = _mm256_xor_si256(result, _mm256_and_si256(planes.eights, flip));
+			}
+			_mm256_storeu_si256((__m256i*)&out[w], result);
+		}
+	}
+	bitboard_row_kernel_scalar<Conway>(above + w - 1, middle + w - 1, below + w - 1, out + w - 1, data_words - w + 1, rule);
+}
+
+// Truth tables for _mm512_ternarylogic_epi64, indexed by (a << 2) | (b << 1) | c.
+#define TERNARY_XOR3 0x96
+#define TERNARY_MAJORITY 0xE8
+#define TERNARY_OR3 0xFE
+// c & ~(a | b)
+#define TERNARY_C_AND_NOT_A_OR_B 0x02
+// a & (b | c)
+#define TERNARY_A_AND_B_OR_C 0xE0
+// a ? b : c
+#define TERNARY_SELECT 0xCA
+// a ^ (b & c)
+#define TERNARY_A_XOR_B_AND_C 0x78
+
+struct NeighbourCountPlanes512 {
+	__m512i ones;
+	__m512i twos;
+	__m512i fours;
+	__m512i eights;
+};
+
+// Shifts through the zero-masking forms with every lane selected. They are
+// the same instruction as _mm512_slli_epi64 / _mm512_srli_epi64, but GCC 12
+// implements those with an _mm512_undefined_epi32() source that trips
+// -Wmaybe-uninitialized.
+#define SHIFT_LEFT_512(v, n) _mm512_maskz_slli_epi64((__mmask8)0xFF, v, n)
+#define SHIFT_RIGHT_512(v, n) _mm512_maskz_srli_epi64((__mmask8)0xFF, v, n)
+
+BITBOARD_TARGET("avx512f")
+static inline void count_neighbours_avx512(const uint64_t* above, const uint64_t* middle, const uint64_t* below, int w, NeighbourCountPlanes512& planes) {
+	__m512i a = _mm512_loadu_si512(&above[w]);
+	__m512i m = _mm512_loadu_si512(&middle[w]);
+	__m512i b = _mm512_loadu_si512(&below[w]);
+
+	__m512i a_w = _mm512_or_si512(SHIFT_LEFT_512(a, 1), SHIFT_RIGHT_512(_mm512_loadu_si512(&above[w - 1]), 63));
+	__m512i a_e = _mm512_or_si512(SHIFT_RIGHT_512(a, 1), SHIFT_LEFT_512(_mm512_loadu_si512(&above[w + 1]), 63));
+	__m512i m_w = _mm512_or_si512(SHIFT_LEFT_512(m, 1), SHIFT_RIGHT_512(_mm512_loadu_si512(&middle[w - 1]), 63));
+	__m512i m_e = _mm512_or_si512(SHIFT_RIGHT_512(m, 1), SHIFT_LEFT_512(_mm512_loadu_si512(&middle[w + 1]), 63));
+	__m512i b_w = _mm512_or_si512(SHIFT_LEFT_512(b, 1), SHIFT_RIGHT_512(_mm512_loadu_si512(&below[w - 1]), 63));
+	__m512i b_e = _mm512_or_si512(SHIFT_RIGHT_512(b, 1), SHIFT_LEFT_512(_mm512_loadu_si512(&below[w + 1]), 63));
+
+	// Full adders are a single ternary op each for the sum and the carry.
+	__m512i a_sum = _mm512_ternarylogic_epi64(a_w, a, a_e, TERNARY_XOR3);
+	__m512i a_carry = _mm512_ternarylogic_epi64(a_w, a, a_e, TERNARY_MAJORITY);
+
+	__m512i m_sum = _mm512_xor_si512(m_w, m_e);
+	__m512i m_carry = _mm512_and_si512(m_w, m_e);
+
+	__m512i b_sum = _mm512_ternarylogic_epi64(b_w, b, b_e, TERNARY_XOR3);
+	__m512i b_carry = _mm512_ternarylogic_epi64(b_w, b, b_e, TERNARY_MAJORITY);
+
+	__m512i ones_carry = _mm512_ternarylogic_epi64(a_sum, m_sum, b_sum, TERNARY_MAJORITY);
+
+	__m512i x = _mm512_xor_si512(a_carry, m_carry);
+	__m512i y = _mm512_xor_si512(b_carry, ones_carry);
+	__m512i pair_a = _mm512_and_si512(a_carry, m_carry);
+	__m512i pair_b = _mm512_and_si512(b_carry, ones_carry);
+	__m512i pair_xy = _mm512_and_si512(x, y);
+
+	planes.ones = _mm512_ternarylogic_epi64(a_sum, m_sum, b_sum, TERNARY_XOR3);
+	planes.twos = _mm512_xor_si512(x, y);
+	planes.fours = _mm512_ternarylogic_epi64(pair_a, pair_b, pair_xy, TERNARY_XOR3);
+	planes.eights = _mm512_and_si512(pair_a, pair_b);
+}
+
+// _mm512_ternarylogic_epi64 only takes its truth table as an immediate, this
+// picks the instruction for a table known at run time. The table is the same
+// for a whole row, so the jump is always predicted.
+#define TERNARY_CASE(n) case n: return _mm512_ternarylogic_epi64(a, b, c, n);
+#define TERNARY_CASES_4(n) TERNARY_CASE(n) TERNARY_CASE(n + 1) TERNARY_CASE(n + 2) TERNARY_CASE(n + 3)
+#define TERNARY_CASES_16(n) TERNARY_CASES_4(n) TERNARY_CASES_4(n + 4) TERNARY_CASES_4(n + 8) TERNARY_CASES_4(n + 12)
+#define TERNARY_CASES_64(n) TERNARY_CASES_16(n) TERNARY_CASES_16(n + 16) TERNARY_CASES_16(n + 32) TERNARY_CASES_16(n + 48)
+
+BITBOARD_TARGET("avx512f")
+static inline __m512i ternary_logic_avx512(__m512i a, __m512i b, __m512i c, int table) {
+	switch (table) {
+		TERNARY_CASES_64(0)
+		TERNARY_CASES_64(64)
+		TERNARY_CASES_64(128)
+		TERNARY_CASES_64(192)
+	}
+	return a;
+}
+
+template <bool Conway>
+BITBOARD_TARGET("avx512f")
+static void bitboard_row_kernel_avx512(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule) {
+	int w = 1;
+	if constexpr (Conway) {
+		for (; w + 7 <= data_words; w += 8) {
+			NeighbourCountPlanes512 planes;
+			count_neighbours_avx512(above, middle, below, w, planes);
+			__m512i m = _mm512_loadu_si512(&middle[w]);
+			__m512i low_count = _mm512_ternarylogic_epi64(planes.fours, planes.eights, planes.twos, TERNARY_C_AND_NOT_A_OR_B);
+			__m512i result = _mm512_ternarylogic_epi64(low_count, planes.ones, m, TERNARY_A_AND_B_OR_C);
+			_mm512_storeu_si512(&out[w], result);
+		}
+	} else {
+		// With (fours, twos, ones) as the inputs the truth table index is the
+		// neighbour count, so the survive and birth masks are the tables and any
+		// rule takes three instructions. 8 neighbours read as 0 and are flipped
+		// afterwards if the rule treats them differently.
+		int survive_table = rule.life_rule.survive_mask & 0xFF;
+		int birth_table = rule.life_rule.birth_mask & 0xFF;
+		int survive_flip = ((rule.life_rule.survive_mask >> 8) ^ rule.life_rule.survive_mask) & 1;
+		int birth_flip = ((rule.life_rule.birth_mask >> 8) ^ rule.life_rule.birth_mask) & 1;
+		__m512i survive_flips = _mm512_set1_epi64(survive_flip ? -1 : 0);
+		__m512i birth_flips = _mm512_set1_epi64(birth_flip ? -1 : 0);
+		for (; w + 7 <= data_words; w += 8) {
+			NeighbourCountPlanes512 planes;
+			count_neighbours_avx512(above, middle, below, w, planes);
+			__m512i m = _mm512_loadu_si512(&middle[w]);
+			__m512i survive = ternary_logic_avx512(planes.fours, planes.twos, planes.ones, survive_table);
+			__m512i birth = ternary_logic_avx512(planes.fours, planes.twos, planes.ones, birth_table);
+			__m512i result = _mm512_ternarylogic_epi64(m, survive, birth, TERNARY_SELECT);
+			if (survive_flip | birth_flip) {
+				__m512i flip = _mm512_ternarylogic_epi64(m, survive_flips, birth_flips, TERNARY_SELECT);
+				result = _mm512_ternarylogic_epi64(result, planes.eights, flip, TERNARY_A_XOR_B_AND_C);
+			}
+			_mm512_storeu_si512(&out[w], result);
+		}
+	}
+	bitboard_row_kernel_avx2<Conway>(above + w - 1, middle + w - 1, below + w - 1, out + w - 1, data_words - w + 1, rule);
+}
+
+#else
+
+template <bool Conway>
+static void bitboard_row_kernel_avx2(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule) {
+	bitboard_row_kernel_scalar<Conway>(above, middle, below, out, data_words, rule);
+}
+
+template <bool Conway>
+static void bitboard_row_kernel_avx512(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule) {
+	bitboard_row_kernel_scalar<Conway>(above, middle, below, out, data_words, rule);
+}
+
+#endif
+
+
+BitboardRowKernel get_bitboard_row_kernel(BitboardKernelIsa isa, bool conway) {
+#ifdef BITBOARD_HAS_X86_KERNELS
+	if (isa == BitboardKernelIsa::Avx512) {
+		return conway ? bitboard_row_kernel_avx512<true> : bitboard_row_kernel_avx512<false>;
+	}
+	if (isa == BitboardKernelIsa::Avx2) {
+		return conway ? bitboard_row_kernel_avx2<true> : bitboard_row_kernel_avx2<false>;
+	}
+#endif
+	return conway ? bitboard_row_kernel_scalar<true> : bitboard_row_kernel_scalar<false>;
+}
+
+void bitboard_row_kernel_table(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule) {
+	const uint8_t* pair_table = rule.pair_table.data();
+	for (int w = 1; w <= data_words; w++) {
+		out[w] = table_rule_word(
+			above[w - 1], above[w], above[w + 1],
+			middle[w - 1], middle[w], middle[w + 1],
+			below[w - 1], below[w], below[w + 1], pair_table);
+	}
+}
+
+BitboardRowKernel select_bitboard_row_kernel(LifeRule rule) {
+	if (rule.non_totalistic) {
+		return bitboard_row_kernel_table;
+	}
+	BitboardKernelIsa isa = BitboardKernelIsa::Scalar;
+	if (SDL_HasAVX512F()) {
+		isa = BitboardKernelIsa::Avx512;
+	} else if (SDL_HasAVX2()) {
+		isa = BitboardKernelIsa::Avx2;
+	}
+	return get_bitboard_row_kernel(isa, rule.is_conway());
+}
+
+const char* bitboard_row_kernel_name(BitboardRowKernel kernel) {
+#ifdef BITBOARD_HAS_X86_KERNELS
+	if (kernel == bitboard_row_kernel_avx512<true> || kernel == bitboard_row_kernel_avx512<false>) {
+		return "AVX-512";
+	}
+	if (kernel == bitboard_row_kernel_avx2<true> || kernel == bitboard_row_kernel_avx2<false>) {
+		return "AVX2";
+	}
+#endif
+	if (kernel == bitboard_row_kernel_table) {
+		return "lookup table";
+	}
+	return "scalar";
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "life_rule.h"
+#include "rule_circuit.h"
+
+// Sums the eight neighbours of 64 cells at once. The result is returned as
+// four bit planes (weights 1, 2, 4 and 8), so the rule can be evaluated with
+// plain bitwise logic. above/middle/below are the words of the three rows,
+// the *_left/*_right words are the horizontally adjacent words of each row.
+struct NeighbourCountPlanes {
+	uint64_t ones;
+	uint64_t twos;
+	uint64_t fours;
+	uint64_t eights;
+};
+
+inline NeighbourCountPlanes count_neighbours(
+	uint64_t above_left, uint64_t above, uint64_t above_right,
+	uint64_t middle_left, uint64_t middle, uint64_t middle_right,
+	uint64_t below_left, uint64_t below, uint64_t below_right) {
+	// Bit i of a word is column 64 * k + i, so the west neighbour of bit i is
+	// bit i - 1 (shift left) and the east neighbour is bit i + 1 (shift right).
+	uint64_t a_w = (above << 1) | (above_left >> 63);
+	uint64_t a_e = (above >> 1) | (above_right << 63);
+	uint64_t m_w = (middle << 1) | (middle_left >> 63);
+	uint64_t m_e = (middle >> 1) | (middle_right << 63);
+	uint64_t b_w = (below << 1) | (below_left >> 63);
+	uint64_t b_e = (below >> 1) | (below_right << 63);
+
+	// Horizontal sums per row as 2-bit numbers (carry, sum).
+	uint64_t a_xor = a_w ^ above;
+	uint64_t a_sum = a_xor ^ a_e;
+	uint64_t a_carry = (a_w & above) | (a_xor & a_e);
+
+	uint64_t m_sum = m_w ^ m_e;
+	uint64_t m_carry = m_w & m_e;
+
+	uint64_t b_xor = b_w ^ below;
+	uint64_t b_sum = b_xor ^ b_e;
+	uint64_t b_carry = (b_w & below) | (b_xor & b_e);
+
+	// Add the three weight-1 bits.
+	uint64_t s_xor = a_sum ^ m_sum;
+	uint64_t ones = s_xor ^ b_sum;
+	uint64_t ones_carry = (a_sum & m_sum) | (s_xor & b_sum);
+
+	// Add the four weight-2 bits.
+	uint64_t x = a_carry ^ m_carry;
+	uint64_t y = b_carry ^ ones_carry;
+	uint64_t pair_a = a_carry & m_carry;
+	uint64_t pair_b = b_carry & ones_carry;
+	uint64_t pair_xy = x & y;
+
+	NeighbourCountPlanes planes;
+	planes.ones = ones;
+	planes.twos = x ^ y;
+	planes.fours = pair_a ^ pair_b ^ pair_xy;
+	planes.eights = pair_a & pair_b;
+	return planes;
+}
+
+// B3/S23: alive next generation iff the count is 3, or it is 2 and the cell is
+// alive. Both counts have twos set and fours/eights clear.
+inline uint64_t conway_rule(uint64_t alive, NeighbourCountPlanes planes) {
+	return planes.twos & ~(planes.fours | planes.eights) & (planes.ones | alive);
+}
+
+// Any outer-totalistic rule, by running its compiled circuit on the planes.
+inline uint64_t life_rule_result(uint64_t alive, NeighbourCountPlanes planes, const RuleCircuit& circuit) {
+	return circuit.evaluate(planes.ones, planes.twos, planes.fours, planes.eights, alive);
+}
+
+// What the kernels need to evaluate a rule, prepared once when the rule is set.
+struct BitboardRule {
+	LifeRule life_rule;
+	// Only for outer-totalistic rules.
+	RuleCircuit circuit;
+	// Only for non-totalistic rules: the next state of two horizontally
+	// adjacent cells (bit 0 the western one), indexed by their 3 x 4
+	// neighbourhood. Each row contributes 4 cells, west in the low bit; the
+	// row above is in bits 0..3, the cells' own row in 4..7, the row below in 8..11.
+	std::vector<uint8_t> pair_table;
+
+	BitboardRule() : BitboardRule(LifeRule()) {}
+
+	BitboardRule(LifeRule life_rule1) : life_rule(life_rule1) {
+		if (!life_rule.non_totalistic) {
+			circuit = RuleCircuit::compile(life_rule);
+			return;
+		}
+		pair_table.assign(4096, 0);
+		for (int index = 0; index < 4096; index++) {
+			for (int cell = 0; cell < 2; cell++) {
+				int above = (index >> cell) & 7;
+				int middle = (index >> (4 + cell)) & 7;
+				int below = (index >> (8 + cell)) & 7;
+				pair_table[index] |= life_rule.next_state_of(above | (middle << 3) | (below << 6)) << cell;
+			}
+		}
+	}
+};
+
+// Non-totalistic rules by table lookup, two cells at a time. The arguments
+// are the same nine words as for count_neighbours.
+inline uint64_t table_rule_word(
+	uint64_t above_left, uint64_t above, uint64_t above_right,
+	uint64_t middle_left, uint64_t middle, uint64_t middle_right,
+	uint64_t below_left, uint64_t below, uint64_t below_right,
+	const uint8_t* pair_table) {
+	// Bit j of *_low is column j - 1 of the row, *_high holds columns 63 and 64.
+	uint64_t above_low = (above << 1) | (above_left >> 63);
+	uint64_t middle_low = (middle << 1) | (middle_left >> 63);
+	uint64_t below_low = (below << 1) | (below_left >> 63);
+	uint64_t result = 0;
+	for (int i = 0; i < 62; i += 2) {
+		int index = (int)(((above_low >> i) & 15) | (((middle_low >> i) & 15) << 4) | (((below_low >> i) & 15) << 8));
+		result |= (uint64_t)pair_table[index] << i;
+	}
+	uint64_t above_high = (above >> 63) | ((above_right & 1) << 1);
+	uint64_t middle_high = (middle >> 63) | ((middle_right & 1) << 1);
+	uint64_t below_high = (below >> 63) | ((below_right & 1) << 1);
+	int index = (int)(((above_low >> 62) | (above_high << 2)) | (((middle_low >> 62) | (middle_high << 2)) << 4) | (((below_low >> 62) | (below_high << 2)) << 8));
+	return result | (uint64_t)pair_table[index] << 62;
+}
+
+// Computes words 1..data_words of one output row. The row pointers point at
+// the ghost word in front of the row, so w - 1 and w + 1 are always readable.
+typedef void (*BitboardRowKernel)(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule);
+
+enum class BitboardKernelIsa {
+	Scalar,
+	Avx2,
+	Avx512
+};
+
+// Kernel for one instruction set, specialized for B3/S23 if conway is set.
+// Instruction sets the build has no kernels for fall back to scalar.
+BitboardRowKernel get_bitboard_row_kernel(BitboardKernelIsa isa, bool conway);
+// Non-totalistic rules, using BitboardRule::pair_table.
+void bitboard_row_kernel_table(const uint64_t* above, const uint64_t* middle, const uint64_t* below, uint64_t* out, int data_words, const BitboardRule& rule);
+// Picks the widest kernel the CPU supports, using SDL's CPU detection, or the
+// table kernel for non-totalistic rules.
+BitboardRowKernel select_bitboard_row_kernel(LifeRule rule);
+const char* bitboard_row_kernel_name(BitboardRowKernel kernel);
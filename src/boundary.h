@@ -0,0 +1,126 @@
+#pragma once
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// What lies beyond the edges of the grid. Engines that support more than a
+// dead border do it one of two ways. BitboardGrid and GenerationsGrid keep a
+// halo of cells around the grid and refill it from the grid once per
+// generation (fill_bitboard_halo), so their kernels read neighbours without
+// any bounds checks or wrap-around arithmetic. ByteGrid has no halo: cells
+// on the edge take the slower edge_neighbourhood path, which looks up each
+// neighbour outside the grid through boundary_source.
+enum class Boundary {
+	// Everything outside the grid is dead.
+	Dead,
+	// Leaving through one edge comes back through the opposite one.
+	Torus,
+	// A torus whose top and bottom edges are glued with a half twist:
+	// crossing them mirrors the column.
+	KleinBottle,
+	// Both pairs of edges glued with a half twist (the real projective
+	// plane). The corners of the square have no consistent neighbours
+	// across the corner and stay dead.
+	CrossSurface,
+	// The cells beyond an edge repeat the cells on it.
+	Mirror
+};
+
+inline const char* boundary_name(Boundary boundary) {
+	switch (boundary) {
+	case Boundary::Dead: return "dead";
+	case Boundary::Torus: return "torus";
+	case Boundary::KleinBottle: return "klein";
+	case Boundary::CrossSurface: return "cross";
+	case Boundary::Mirror: return "mirror";
+	}
+	return "dead";
+}
+
+// Accepts the names boundary_name returns, in any case. Prints an error and
+// returns false for anything else.
+inline bool parse_boundary(const std::string& text, Boundary& boundary) {
+	std::string lower;
+	for (char ch : text) {
+		lower += (char)std::tolower((unsigned char)ch);
+	}
+	for (Boundary candidate : { Boundary::Dead, Boundary::Torus, Boundary::KleinBottle, Boundary::CrossSurface, Boundary::Mirror }) {
+		if (lower == boundary_name(candidate)) {
+			boundary = candidate;
+			return true;
+		}
+	}
+	std::cout << "Unknown boundary: " << text << ", expected dead, torus, klein, cross or mirror." << std::endl;
+	return false;
+}
+
+// Maps a position (r, c) at most one cell outside a rows x columns grid,
+// such as a halo cell, to the grid cell the boundary shows there. Returns false if the
+// position is dead.
+inline bool boundary_source(Boundary boundary, int rows, int columns, int& r, int& c) {
+	bool outside_rows = r < 0 || r >= rows;
+	bool outside_columns = c < 0 || c >= columns;
+	switch (boundary) {
+	case Boundary::Dead:
+		return false;
+	case Boundary::Torus:
+		break;
+	case Boundary::KleinBottle:
+		if (outside_rows) {
+			c = columns - 1 - c;
+		}
+		break;
+	case Boundary::CrossSurface:
+		if (outside_rows && outside_columns) {
+			return false;
+		}
+		if (outside_rows) {
+			c = columns - 1 - c;
+		}
+		if (outside_columns) {
+			r = rows - 1 - r;
+		}
+		break;
+	case Boundary::Mirror:
+		r = r < 0 ? 0 : (r >= rows ? rows - 1 : r);
+		c = c < 0 ? 0 : (c >= columns ? columns - 1 : c);
+		return true;
+	}
+	r = (r + rows) % rows;
+	c = (c + columns) % columns;
+	return true;
+}
+
+// Fills the halo of a grid in the BitboardGrid layout: 64 cells per word,
+// grid row r in padded row r + 1 and column c at bit c + 64 of the row, so
+// column -1 is the top bit of the ghost word in front of the row and column
+// columns the bit right after the last cell. Only the cells that are
+// neighbours of grid cells are written, O(rows + columns) per call.
+inline void fill_bitboard_halo(uint64_t* words, int words_per_row, int rows, int columns, Boundary boundary) {
+	auto bit_position = [words_per_row](int r, int c, size_t& word, int& shift) {
+		word = (size_t)(r + 1) * words_per_row + (c + 64) / 64;
+		shift = (c + 64) % 64;
+	};
+	auto fill = [&](int r, int c) {
+		int source_r = r;
+		int source_c = c;
+		uint64_t value = 0;
+		size_t word;
+		int shift;
+		if (boundary_source(boundary, rows, columns, source_r, source_c)) {
+			bit_position(source_r, source_c, word, shift);
+			value = (words[word] >> shift) & 1;
+		}
+		bit_position(r, c, word, shift);
+		words[word] = (words[word] & ~(uint64_t(1) << shift)) | (value << shift);
+	};
+	for (int c = -1; c <= columns; c++) {
+		fill(-1, c);
+		fill(rows, c);
+	}
+	for (int r = 0; r < rows; r++) {
+		fill(r, -1);
+		fill(r, columns);
+	}
+}
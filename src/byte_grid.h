@@ -0,0 +1,118 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "life_engine.h"
+#include "grid_layouts.h"
+
+// One byte per cell, double buffered: a step reads every cell from the front
+// buffer, writes the next generation into the back buffer and swaps the two,
+// so there is no copy phase and no stored neighbour count.
+//
+// Layout is one of the policies in grid_layouts.h and decides both where a
+// cell is stored and the order the step visits cells in. The layout covers
+// exactly the grid, so a power-of-two grid stays one in the padded layouts.
+// Only the cells on the grid's edge have neighbours outside it; they read
+// those through the boundary, every other cell reads its block directly.
+template <typename Layout = RowMajorLayout>
+class ByteGrid : public LifeEngine {
+public:
+	ByteGrid(int rows1, int columns1) : layout(rows1, columns1) {
+		rows = rows1;
+		columns = columns1;
+		boundary = Boundary::Dead;
+		front.assign(layout.size(), 0);
+		back.assign(layout.size(), 0);
+	}
+
+	void step() override {
+		layout.traverse([this](int r, int c) {
+			bool on_edge = r == 0 || c == 0 || r == rows - 1 || c == columns - 1;
+			back[layout.index(r, c)] = rule.next_state_of(on_edge ? edge_neighbourhood(r, c) : neighbourhood(r, c));
+		});
+		front.swap(back);
+	}
+
+	bool is_alive(int r, int c) override {
+		return front[index(r, c)];
+	}
+
+	void set_alive(int r, int c, bool alive) override {
+		front[index(r, c)] = alive;
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	bool set_rule(LifeRule rule1) override {
+		if (rule1.is_generations()) {
+			std::cout << "ByteGrid cannot run " << rule1.to_string() << ", Generations rules need the Generations engine." << std::endl;
+			return false;
+		}
+		rule = rule1;
+		return true;
+	}
+
+	LifeRule get_rule() override {
+		return rule;
+	}
+
+	bool set_boundary(Boundary boundary1) override {
+		boundary = boundary1;
+		return true;
+	}
+
+	Boundary get_boundary() override {
+		return boundary;
+	}
+
+	// Storage offset of grid cell (r, c).
+	size_t index(int r, int c) {
+		return layout.index(r, c);
+	}
+
+	Layout layout;
+	LifeRule rule;
+	Boundary boundary;
+	int rows;
+	int columns;
+
+	std::vector<uint8_t> front;
+	std::vector<uint8_t> back;
+
+private:
+	// The 3x3 block around (r, c) as an index into LifeRule::table, for cells
+	// whose neighbours are all inside the grid.
+	int neighbourhood(int r, int c) {
+		int cells = 0;
+		for (int dr = -1; dr <= 1; dr++) {
+			for (int dc = -1; dc <= 1; dc++) {
+				cells |= front[layout.index(r + dr, c + dc)] << (3 * (dr + 1) + dc + 1);
+			}
+		}
+		return cells;
+	}
+
+	// The same for a cell on the edge, neighbours outside the grid come from
+	// the cell the boundary maps them to.
+	[[gnu::noinline]] int edge_neighbourhood(int r, int c) {
+		int cells = 0;
+		for (int dr = -1; dr <= 1; dr++) {
+			for (int dc = -1; dc <= 1; dc++) {
+				int source_r = r + dr;
+				int source_c = c + dc;
+				bool inside = source_r >= 0 && source_r < rows && source_c >= 0 && source_c < columns;
+				if (inside || boundary_source(boundary, rows, columns, source_r, source_c)) {
+					cells |= front[layout.index(source_r, source_c)] << (3 * (dr + 1) + dc + 1);
+				}
+			}
+		}
+		return cells;
+	}
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <SDL.h>
+
+#include "life_engine.h"
+
+// The cells of a grid as a streaming texture, one texel per cell. A frame
+// writes the cell colours straight into the locked texture and the grid is
+// then drawn with a single scaled SDL_RenderCopy, instead of a colour change
+// and a fill call per cell.
+//
+// Colours come from a 256 entry palette of ARGB8888 texels indexed by the
+// byte read_cells() returns, so the per-cell work is one table lookup. Rows
+// and columns outside the engine's live bounds are filled with the dead
+// colour without reading the engine.
+class CellTexture {
+public:
+	CellTexture() {
+		texture = nullptr;
+		rows = 0;
+		columns = 0;
+		std::fill(palette, palette + 256, 0);
+	}
+
+	~CellTexture() {
+		if (texture) {
+			SDL_DestroyTexture(texture);
+		}
+	}
+
+	CellTexture(const CellTexture&) = delete;
+	CellTexture& operator=(const CellTexture&) = delete;
+
+	static Uint32 texel(Uint8 r, Uint8 g, Uint8 b) {
+		return (Uint32)0xFF << 24 | (Uint32)r << 16 | (Uint32)g << 8 | b;
+	}
+
+	// Writes the rows1 x columns1 block at the top left of the cells into
+	// the texture, recreating it if the size changed. Prints an error and
+	// returns false if SDL fails.
+	bool update(SDL_Renderer& renderer, CellReader& engine, int rows1, int columns1) {
+		if (!texture || rows != rows1 || columns != columns1) {
+			if (texture) {
+				SDL_DestroyTexture(texture);
+			}
+			rows = rows1;
+			columns = columns1;
+			texture = SDL_CreateTexture(&renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, columns, rows);
+			if (!texture) {
+				std::cout << "Error creating the cell texture: " << SDL_GetError() << std::endl;
+				return false;
+			}
+			SDL_SetTextureScaleMode(texture, SDL_ScaleModeNearest);
+			row_cells.resize(columns);
+		}
+
+		void* pixels;
+		int pitch;
+		if (SDL_LockTexture(texture, nullptr, &pixels, &pitch) != 0) {
+			std::cout << "Error locking the cell texture: " << SDL_GetError() << std::endl;
+			return false;
+		}
+		// A locked streaming texture is write-only, every texel is written.
+		Uint32 dead = palette[0];
+		CellBox bounds = engine.get_live_bounds();
+		int top = std::min(bounds.top, rows);
+		int bottom = std::min(bounds.bottom, rows);
+		int left = std::min(bounds.left, columns);
+		int right = std::min(bounds.right, columns);
+		for (int r = 0; r < rows; r++) {
+			Uint32* row = (Uint32*)((Uint8*)pixels + (size_t)r * pitch);
+			if (r < top || r >= bottom || left >= right) {
+				std::fill_n(row, columns, dead);
+				continue;
+			}
+			std::fill_n(row, left, dead);
+			engine.read_cells(r, left, 1, right - left, row_cells.data());
+			for (int c = left; c < right; c++) {
+				row[c] = palette[row_cells[c - left]];
+			}
+			std::fill_n(row + right, columns - right, dead);
+		}
+		SDL_UnlockTexture(texture);
+		return true;
+	}
+
+	// Texel of every value read_cells() can return.
+	Uint32 palette[256];
+
+	SDL_Texture* texture;
+	int rows;
+	int columns;
+
+private:
+	std::vector<uint8_t> row_cells;
+};
@@ -0,0 +1,917 @@
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "life_engine.h"
+#include "simulation_thread.h"
+#include "byte_grid.h"
+#include "bitboard_grid.h"
+#include "hashlife.h"
+#include "sparse_tile_grid.h"
+#include "generations_grid.h"
+#include "larger_than_life_grid.h"
+#include "lenia_grid.h"
+#include "incremental_grid.h"
+#include "cell_texture.h"
+#include "frame_arena.h"
+
+class DrawingRectangleEvent {
+public:
+	// The rect is stored by value, cell rects are computed at draw time and do not outlive the frame.
+	DrawingRectangleEvent(SDL_Rect rect, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+		: r(r), g(g), b(b), a(a), rectangle(rect) {};
+
+	void execute_drawing_event(SDL_Renderer& renderer) {
+		SDL_SetRenderDrawColor(&renderer, r, g, b, a);
+		SDL_RenderFillRect(&renderer, &rectangle);
+	}
+
+	Uint8 r;
+	Uint8 g;
+	Uint8 b;
+	Uint8 a;
+
+	SDL_Rect rectangle;
+};
+
+
+class DrawingLineEvent {
+public:
+	DrawingLineEvent(int x1, int y1, int x2, int y2, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+		: x1(x1), y1(y1), x2(x2), y2(y2), r(r), g(g), b(b), a(a) {};
+
+	void execute_drawing_event(SDL_Renderer& renderer) {
+		SDL_SetRenderDrawColor(&renderer, r, g, b, a);
+		SDL_RenderDrawLine(&renderer, x1, y1, x2, y2);
+	}
+
+	int x1;
+	int y1;
+
+	int x2;
+	int y2;
+
+	Uint8 r;
+	Uint8 g;
+	Uint8 b;
+	Uint8 a;
+};
+
+
+class DrawingTextureEvent {
+public:
+	// Draws the whole texture scaled to the destination rect.
+	DrawingTextureEvent(SDL_Texture* texture, SDL_Rect destination)
+		: texture(texture), destination(destination) {};
+
+	void execute_drawing_event(SDL_Renderer& renderer) {
+		SDL_RenderCopy(&renderer, texture, nullptr, &destination);
+	}
+
+	SDL_Texture* texture;
+	SDL_Rect destination;
+};
+
+
+// SDL calls made by one execute_drawing_events.
+struct DrawCallCounts {
+	// Fill, line and copy calls.
+	int draw_calls;
+	int colour_changes;
+	int rectangles;
+	int lines;
+
+	bool operator==(const DrawCallCounts&) const = default;
+};
+
+
+class DrawingEventQueue {
+public:
+	static const int INITIAL_EVENTS = 4096;
+
+	DrawingEventQueue()
+		: rectangle_events(64), batched_rectangle_events(INITIAL_EVENTS), texture_events(4), line_events(INITIAL_EVENTS), line_rectangles(INITIAL_EVENTS) {
+		draw_call_counts = {};
+		colour_batch_added = false;
+	}
+
+	// Called before the events of a frame are appended.
+	void begin_frame() {
+		rectangle_events.begin_frame();
+		batched_rectangle_events.begin_frame();
+		texture_events.begin_frame();
+		line_events.begin_frame();
+		line_rectangles.begin_frame();
+		for (ColourBatch& batch : colour_batches) {
+			batch.rectangles.begin_frame();
+		}
+		colour_batch_added = false;
+	}
+
+	// Did this frame need more memory than any frame before it. Only then may
+	// drawing allocate.
+	bool grew_this_frame() {
+		bool grew = rectangle_events.grew || batched_rectangle_events.grew || texture_events.grew || line_events.grew || line_rectangles.grew || colour_batch_added;
+		for (ColourBatch& batch : colour_batches) {
+			grew = grew || batch.rectangles.grew;
+		}
+		return grew;
+	}
+
+	// Rectangles first, then batched rectangles and textures, then lines on top.
+	void execute_drawing_events(SDL_Renderer& renderer) {
+		draw_call_counts = {};
+		execute_drawing_rectangle_events(renderer);
+		execute_batched_rectangle_events(renderer);
+		execute_drawing_texture_events(renderer);
+		execute_drawing_line_events(renderer);
+	}
+	// Events live for one frame, in arenas that keep their memory between
+	// frames.
+	FrameArena<DrawingRectangleEvent> rectangle_events;
+	// Rectangles that do not overlap each other, such as cells. They may be
+	// drawn in any order, so they are grouped by colour and every colour
+	// takes one SDL_SetRenderDrawColor and one SDL_RenderFillRects.
+	FrameArena<DrawingRectangleEvent> batched_rectangle_events;
+	FrameArena<DrawingTextureEvent> texture_events;
+	FrameArena<DrawingLineEvent> line_events;
+	// Counts of the last execute_drawing_events.
+	DrawCallCounts draw_call_counts;
+private:
+	// Rectangles of one colour, kept between frames so their storage is reused.
+	struct ColourBatch {
+		Uint8 r;
+		Uint8 g;
+		Uint8 b;
+		Uint8 a;
+		FrameArena<SDL_Rect> rectangles;
+	};
+
+	static Uint32 colour_key(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+		return (Uint32)r << 24 | (Uint32)g << 16 | (Uint32)b << 8 | a;
+	}
+
+	void set_colour(SDL_Renderer& renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+		SDL_SetRenderDrawColor(&renderer, r, g, b, a);
+		draw_call_counts.colour_changes++;
+	}
+
+	// Events run in the order they were appended, so the background is drawn below the cells.
+	void execute_drawing_rectangle_events(SDL_Renderer& renderer) {
+		for (DrawingRectangleEvent& e : rectangle_events) {
+			e.execute_drawing_event(renderer);
+		}
+		draw_call_counts.draw_calls += (int)rectangle_events.size();
+		draw_call_counts.colour_changes += (int)rectangle_events.size();
+		draw_call_counts.rectangles += (int)rectangle_events.size();
+		rectangle_events.reset();
+	}
+	void execute_batched_rectangle_events(SDL_Renderer& renderer) {
+		// Neighbouring cells mostly share a colour, so remember the last batch.
+		Uint32 last_key = 0;
+		ColourBatch* last_batch = nullptr;
+		for (DrawingRectangleEvent& e : batched_rectangle_events) {
+			Uint32 key = colour_key(e.r, e.g, e.b, e.a);
+			if (!last_batch || key != last_key) {
+				auto found = colour_batch_index.find(key);
+				if (found == colour_batch_index.end()) {
+					found = colour_batch_index.emplace(key, colour_batches.size()).first;
+					colour_batches.push_back(ColourBatch{ e.r, e.g, e.b, e.a, FrameArena<SDL_Rect>() });
+					colour_batch_added = true;
+				}
+				last_key = key;
+				last_batch = &colour_batches[found->second];
+			}
+			last_batch->rectangles.push_back(e.rectangle);
+		}
+		for (ColourBatch& batch : colour_batches) {
+			if (batch.rectangles.empty()) {
+				continue;
+			}
+			set_colour(renderer, batch.r, batch.g, batch.b, batch.a);
+			SDL_RenderFillRects(&renderer, batch.rectangles.data(), (int)batch.rectangles.size());
+			draw_call_counts.draw_calls++;
+			draw_call_counts.rectangles += (int)batch.rectangles.size();
+			batch.rectangles.reset();
+		}
+		batched_rectangle_events.reset();
+	}
+	void execute_drawing_texture_events(SDL_Renderer& renderer) {
+		for (DrawingTextureEvent& e : texture_events) {
+			e.execute_drawing_event(renderer);
+		}
+		draw_call_counts.draw_calls += (int)texture_events.size();
+		texture_events.reset();
+	}
+	// Lines are drawn in order. A run of horizontal and vertical lines of one
+	// colour goes out as one SDL_RenderFillRects of one pixel wide rectangles,
+	// other lines one SDL_RenderDrawLine each.
+	void execute_drawing_line_events(SDL_Renderer& renderer) {
+		bool has_colour = false;
+		Uint32 current_key = 0;
+		for (DrawingLineEvent& e : line_events) {
+			Uint32 key = colour_key(e.r, e.g, e.b, e.a);
+			if (!has_colour || key != current_key) {
+				flush_line_rectangles(renderer);
+				set_colour(renderer, e.r, e.g, e.b, e.a);
+				has_colour = true;
+				current_key = key;
+			}
+			if (e.x1 == e.x2 || e.y1 == e.y2) {
+				int x = std::min(e.x1, e.x2);
+				int y = std::min(e.y1, e.y2);
+				line_rectangles.push_back(SDL_Rect{ x, y, std::abs(e.x2 - e.x1) + 1, std::abs(e.y2 - e.y1) + 1 });
+			} else {
+				SDL_RenderDrawLine(&renderer, e.x1, e.y1, e.x2, e.y2);
+				draw_call_counts.draw_calls++;
+			}
+			draw_call_counts.lines++;
+		}
+		flush_line_rectangles(renderer);
+		line_events.reset();
+	}
+	void flush_line_rectangles(SDL_Renderer& renderer) {
+		if (line_rectangles.empty()) {
+			return;
+		}
+		SDL_RenderFillRects(&renderer, line_rectangles.data(), (int)line_rectangles.size());
+		draw_call_counts.draw_calls++;
+		line_rectangles.reset();
+	}
+
+	std::vector<ColourBatch> colour_batches;
+	std::unordered_map<Uint32, size_t> colour_batch_index;
+	FrameArena<SDL_Rect> line_rectangles;
+	bool colour_batch_added;
+};
+
+// How DrawingGrid draws the cells: a rectangle per cell with grid lines
+// between them, or one texel per cell in a streaming texture.
+enum class CellRendering {
+	Rectangles,
+	Texture
+};
+
+class DrawingGrid {
+public:
+	// Cells narrower or lower than this many pixels are drawn through the texture.
+	static const int MIN_RECTANGLE_CELL_SIZE = 4;
+	// Largest step is 2^MAX_STEP_LOG2 generations, leaving the generation
+	// count room to grow.
+	static const int MAX_STEP_LOG2 = 48;
+
+	DrawingGrid(int x, int y, int width1, int height1, int rows1, int columns1, EngineType engine_type1 = EngineType::ByteGrid) {
+		grid_top_left_x = x;
+		grid_top_left_y = y;
+		width = width1;
+		height = height1;
+
+		rows = rows1;
+		columns = columns1;
+
+		engine_type = engine_type1;
+		engine = create_engine(engine_type, rows, columns);
+
+		renderer = nullptr;
+		rect_width = std::max(width / columns, 1);
+		rect_height = std::max(height / rows, 1);
+		if (columns > width || rows > height) {
+			// More cells than pixels: the texture shows the whole grid scaled down.
+			cell_rendering = CellRendering::Texture;
+			visible_rows = rows;
+			visible_columns = columns;
+			double scale = std::min((double)width / columns, (double)height / rows);
+			grid_width = std::max((int)(columns * scale), 1);
+			grid_height = std::max((int)(rows * scale), 1);
+		} else {
+			cell_rendering = rect_width < MIN_RECTANGLE_CELL_SIZE || rect_height < MIN_RECTANGLE_CELL_SIZE ? CellRendering::Texture : CellRendering::Rectangles;
+			visible_rows = std::min(rows, height / rect_height);
+			visible_columns = std::min(columns, width / rect_width);
+			grid_width = visible_columns * rect_width;
+			grid_height = visible_rows * rect_height;
+		}
+		row_cells.resize(visible_columns);
+
+		cells_changed = true;
+		full_redraw_needed = true;
+		presented_state_count = 0;
+		presented_continuous = false;
+		grid_target = nullptr;
+		grid_target_failed = false;
+		presented_bounds = { 0, 0, 0, 0 };
+
+		generation = 0;
+		simulation_running = false;
+		step_log2 = 0;
+	}
+
+	~DrawingGrid() {
+		if (grid_target) {
+			SDL_DestroyTexture(grid_target);
+		}
+	}
+
+	static std::unique_ptr<LifeEngine> create_engine(EngineType engine_type, int rows, int columns) {
+		if (engine_type == EngineType::ByteGrid) {
+			return std::make_unique<ByteGrid<RowMajorLayout>>(rows, columns);
+		} else if (engine_type == EngineType::Bitboard) {
+			return std::make_unique<BitboardGrid>(rows, columns);
+		} else if (engine_type == EngineType::HashLife) {
+			return std::make_unique<HashLifeGrid>(rows, columns);
+		} else if (engine_type == EngineType::SparseTiles) {
+			return std::make_unique<SparseTileGrid>(rows, columns);
+		} else if (engine_type == EngineType::LargerThanLife) {
+			return std::make_unique<LargerThanLifeGrid>(rows, columns);
+		} else if (engine_type == EngineType::Lenia) {
+			return std::make_unique<LeniaGrid>(rows, columns);
+		} else if (engine_type == EngineType::Incremental) {
+			return std::make_unique<IncrementalGrid>(rows, columns);
+		}
+		return std::make_unique<GenerationsGrid>(rows, columns);
+	}
+
+	// Hands the engine to a simulation thread. From then on the engine is
+	// only changed through it and drawing reads the snapshots it publishes.
+	void start_simulation() {
+		simulation = std::make_unique<SimulationThread>(*engine, generation);
+		simulation->set_step_log2(step_log2);
+		simulation->set_running(simulation_running);
+		cells_changed = true;
+	}
+
+	// Joins the simulation thread, if there is one, so the engine can be used
+	// directly again. Keeps its generation and whether it was running for
+	// start_simulation().
+	void stop_simulation() {
+		if (!simulation) {
+			return;
+		}
+		simulation->stop();
+		generation = simulation->get_generation();
+		simulation_running = simulation->is_running();
+		simulation.reset();
+		cells_changed = true;
+	}
+
+	// Runs change, which may use or replace the engine, with the simulation
+	// thread stopped, and restarts the thread afterwards.
+	template <typename Change>
+	bool with_engine(Change change) {
+		bool threaded = simulation != nullptr;
+		stop_simulation();
+		bool result = change();
+		if (threaded) {
+			start_simulation();
+		}
+		return result;
+	}
+
+	void set_running(bool running) {
+		simulation_running = running;
+		if (simulation) {
+			simulation->set_running(running);
+		}
+	}
+
+	bool is_running() {
+		return simulation ? simulation->is_running() : simulation_running;
+	}
+
+	// Makes every step advance 2^k generations. Only HashLife jumps ahead
+	// in one go, the other engines print an error and keep single steps.
+	bool set_step_log2(int k) {
+		if (k < 0 || k > MAX_STEP_LOG2) {
+			return false;
+		}
+		if (k > 0 && engine_type != EngineType::HashLife) {
+			std::cout << "Only the HashLife engine steps more than one generation at a time." << std::endl;
+			return false;
+		}
+		step_log2 = k;
+		if (simulation) {
+			simulation->set_step_log2(k);
+		}
+		std::cout << "Step: 2^" << k << " generations." << std::endl;
+		return true;
+	}
+
+	int get_step_log2() {
+		return step_log2;
+	}
+
+	// Cells to draw: the newest snapshot while a simulation thread runs the
+	// engine, the engine itself otherwise.
+	CellReader& cells() {
+		if (simulation) {
+			return simulation->snapshot();
+		}
+		return *engine;
+	}
+
+	// Takes the simulation thread's newest snapshot for drawing. Returns
+	// false if there is none newer than the one drawn last.
+	bool acquire_snapshot() {
+		if (!simulation || !simulation->acquire_snapshot()) {
+			return false;
+		}
+		cells_changed = true;
+		return true;
+	}
+
+	// Replaces the engine, keeping the live cells and, where the new engine
+	// supports it, the boundary.
+	void switch_engine(EngineType engine_type1) {
+		with_engine([&]() {
+			std::unique_ptr<LifeEngine> new_engine = create_engine(engine_type1, rows, columns);
+			new_engine->set_boundary(engine->get_boundary());
+			for (int r = 0; r < rows; r++) {
+				for (int c = 0; c < columns; c++) {
+					if (engine->is_alive(r, c)) {
+						new_engine->set_alive(r, c, true);
+					}
+				}
+			}
+			engine_type = engine_type1;
+			engine = std::move(new_engine);
+			if (engine_type != EngineType::HashLife) {
+				step_log2 = 0;
+			}
+			return true;
+		});
+		cells_changed = true;
+	}
+
+	void flip_state(int r, int c) {
+		if (simulation) {
+			simulation->flip(r, c);
+			return;
+		}
+		engine->set_alive(r, c, !engine->is_alive(r, c));
+		cells_changed = true;
+	}
+
+	void updateGrid() {
+		if (simulation) {
+			simulation->step_once();
+			return;
+		}
+		engine->step_pow2(step_log2);
+		generation += uint64_t(1) << step_log2;
+		cells_changed = true;
+	}
+
+	// rule_string is a B/S rule such as "B36/S23", a B/S/C Generations rule,
+	// which switches to the Generations engine, or a Larger than Life rule
+	// such as "R5,C0,M1,S34..58,B34..45,NM" or a Lenia rule such as
+	// "Lenia,R13,T10,m0.15,s0.015,b1", which switch to their engines. Keeps
+	// the current rule if the string is invalid or the engine cannot run the
+	// rule.
+	bool set_rule(const std::string& rule_string) {
+		return with_engine([&]() { return apply_rule(rule_string); });
+	}
+
+	// boundary_string is one of dead, torus, klein, cross or mirror.
+	bool set_boundary(const std::string& boundary_string) {
+		return with_engine([&]() {
+			Boundary boundary;
+			if (!parse_boundary(boundary_string, boundary) || !engine->set_boundary(boundary)) {
+				return false;
+			}
+			std::cout << "Boundary: " << boundary_name(boundary) << std::endl;
+			return true;
+		});
+	}
+
+	// set_rule() with the engine to itself.
+	bool apply_rule(const std::string& rule_string) {
+		if (!rule_string.empty() && (rule_string[0] == 'R' || rule_string[0] == 'r')) {
+			return set_larger_than_life_rule(rule_string);
+		}
+		if (!rule_string.empty() && (rule_string[0] == 'L' || rule_string[0] == 'l')) {
+			return set_lenia_rule(rule_string);
+		}
+		LifeRule rule;
+		if (!LifeRule::parse(rule_string, rule)) {
+			return false;
+		}
+		if (rule.is_generations() && engine_type != EngineType::Generations) {
+			std::cout << "Switching to the Generations engine." << std::endl;
+			switch_engine(EngineType::Generations);
+		}
+		if (!engine->set_rule(rule)) {
+			// The engine cannot run the rule at all, Lenia for instance, or
+			// not this one, like HashLife with B0. Move to the engine made
+			// for the rule's family instead of staying stuck on this one.
+			EngineType matching_engine = rule.is_generations() ? EngineType::Generations : EngineType::Bitboard;
+			if (engine_type == matching_engine) {
+				return false;
+			}
+			std::cout << "Switching to the " << (rule.is_generations() ? "Generations" : "Bitboard") << " engine." << std::endl;
+			switch_engine(matching_engine);
+			if (!engine->set_rule(rule)) {
+				return false;
+			}
+		}
+		// Generations rules with fewer states drop dying cells.
+		cells_changed = true;
+		std::cout << "Rule: " << rule.to_string() << std::endl;
+		return true;
+	}
+
+	bool set_larger_than_life_rule(const std::string& rule_string) {
+		LargerThanLifeRule rule;
+		if (!LargerThanLifeRule::parse(rule_string, rule)) {
+			return false;
+		}
+		return with_engine([&]() {
+			if (engine_type != EngineType::LargerThanLife) {
+				std::cout << "Switching to the Larger than Life engine." << std::endl;
+				switch_engine(EngineType::LargerThanLife);
+			}
+			static_cast<LargerThanLifeGrid*>(engine.get())->set_larger_than_life_rule(rule);
+			std::cout << "Rule: " << rule.to_string() << std::endl;
+			return true;
+		});
+	}
+
+	bool set_lenia_rule(const std::string& rule_string) {
+		LeniaRule rule;
+		if (!LeniaRule::parse(rule_string, rule)) {
+			return false;
+		}
+		return with_engine([&]() {
+			if (engine_type != EngineType::Lenia) {
+				std::cout << "Switching to the Lenia engine." << std::endl;
+				switch_engine(EngineType::Lenia);
+			}
+			static_cast<LeniaGrid*>(engine.get())->set_lenia_rule(rule);
+			std::cout << "Rule: " << rule.to_string() << std::endl;
+			return true;
+		});
+	}
+
+	// Screen rectangle of a cell, a pure function of its position.
+	SDL_Rect cell_rect(int r, int c) {
+		return { grid_top_left_x + c * rect_width, grid_top_left_y + r * rect_height, rect_width, rect_height };
+	}
+
+	// Dead cells are grey and live cells yellow. Dying cells of Generations
+	// rules fade from orange towards the dead colour as they age.
+	void cell_colour(uint8_t state, int state_count, Uint8& r, Uint8& g, Uint8& b) {
+		if (state == 0) {
+			r = 128, g = 128, b = 128;
+		} else if (state == 1) {
+			r = 255, g = 255, b = 0;
+		} else {
+			// From orange (255, 128, 0) at state 2 most of the way to grey at the last state.
+			int age = (state - 2) * 256 / (state_count - 1);
+			r = (Uint8)(255 - 127 * age / 256);
+			g = 128;
+			b = (Uint8)(128 * age / 256);
+		}
+	}
+
+	// Colour map for continuous cells: dark blue through cyan and yellow to
+	// red, linear between the stops.
+	void continuous_cell_colour(uint8_t value, Uint8& r, Uint8& g, Uint8& b) {
+		static const Uint8 stops[5][3] = { { 0, 0, 96 }, { 0, 96, 255 }, { 0, 255, 192 }, { 255, 255, 0 }, { 255, 48, 0 } };
+		int segment = std::min(value / 64, 3);
+		int t = value - segment * 64;
+		const Uint8* from = stops[segment];
+		const Uint8* to = stops[segment + 1];
+		r = (Uint8)(from[0] + (to[0] - from[0]) * t / 63);
+		g = (Uint8)(from[1] + (to[1] - from[1]) * t / 63);
+		b = (Uint8)(from[2] + (to[2] - from[2]) * t / 63);
+	}
+
+	// Box holding every cell that is not dead, for the UI and exporters.
+	CellBox get_live_bounds() {
+		return cells().get_live_bounds();
+	}
+
+	// Colour of a state or, for continuous engines, of a value.
+	void state_colour(uint8_t state, int state_count, bool continuous, Uint8& r, Uint8& g, Uint8& b) {
+		if (continuous) {
+			continuous_cell_colour(state, r, g, b);
+		} else {
+			cell_colour(state < state_count ? state : 0, state_count, r, g, b);
+		}
+	}
+
+	// Repaint everything on the next frame, after anything that invalidates
+	// what was drawn before: a resized window, a moved view or a lost render
+	// target.
+	void invalidate() {
+		full_redraw_needed = true;
+		cells_changed = true;
+	}
+
+	// Would the next frame draw anything new.
+	bool needs_drawing() {
+		return cells_changed || full_redraw_needed || (simulation && simulation->has_new_snapshot());
+	}
+
+	void append_drawing_events(DrawingEventQueue& event_queue) {
+		acquire_snapshot();
+		int state_count = cells().get_state_count();
+		bool continuous = cells().has_continuous_cells();
+		if (state_count != presented_state_count || continuous != presented_continuous) {
+			// Every colour may have changed.
+			presented_state_count = state_count;
+			presented_continuous = continuous;
+			full_redraw_needed = true;
+		}
+		if (cell_rendering == CellRendering::Texture && renderer) {
+			append_texture_events(event_queue);
+		} else if (renderer && SDL_RenderTargetSupported(renderer) && create_grid_target()) {
+			append_target_events(event_queue);
+		} else {
+			append_rectangle_events(event_queue);
+		}
+		cells_changed = false;
+		full_redraw_needed = false;
+	}
+
+	// Draws every cell straight to the screen: the whole grid in the dead
+	// colour, then only the cells inside the live bounds that are not dead on
+	// top of it.
+	void append_rectangle_events(DrawingEventQueue& event_queue) {
+		CellReader& shown = cells();
+		int state_count = shown.get_state_count();
+		bool continuous = shown.has_continuous_cells();
+		Uint8 dead_red, dead_green, dead_blue;
+		state_colour(0, state_count, continuous, dead_red, dead_green, dead_blue);
+		SDL_Rect grid_rect = { grid_top_left_x, grid_top_left_y, grid_width, grid_height };
+		event_queue.rectangle_events.push_back(DrawingRectangleEvent(grid_rect, dead_red, dead_green, dead_blue, 255));
+
+		CellBox bounds = shown.get_live_bounds();
+		int bottom = std::min(bounds.bottom, visible_rows);
+		int right = std::min(bounds.right, visible_columns);
+		int bounds_width = right - bounds.left;
+		// Read one row at a time into row_cells, sized for the visible columns
+		// up front so drawing does not allocate.
+		for (int r = bounds.top; r < bottom && bounds_width > 0; r++) {
+			shown.read_cells(r, bounds.left, 1, bounds_width, row_cells.data());
+			for (int c = bounds.left; c < right; c++) {
+				uint8_t state = row_cells[c - bounds.left];
+				if (state == 0) {
+					continue;
+				}
+				Uint8 red, green, blue;
+				state_colour(state, state_count, continuous, red, green, blue);
+				event_queue.batched_rectangle_events.push_back(DrawingRectangleEvent(cell_rect(r, c), red, green, blue, 255));
+			}
+		}
+		append_grid_lines(event_queue, grid_top_left_x, grid_top_left_y);
+	}
+
+	// Lines between the visible cells, with the grid's top left corner at (x, y).
+	void append_grid_lines(DrawingEventQueue& event_queue, int x, int y) {
+		for (int r = 1; r < visible_rows; r++) {
+			int line_y = y + r * rect_height;
+			event_queue.line_events.push_back(DrawingLineEvent(x, line_y, x + grid_width, line_y, 0, 0, 0, 255));
+		}
+		for (int c = 1; c < visible_columns; c++) {
+			int line_x = x + c * rect_width;
+			event_queue.line_events.push_back(DrawingLineEvent(line_x, y, line_x, y + grid_height, 0, 0, 0, 255));
+		}
+	}
+
+	// Keeps the grid in a render target that persists between frames and
+	// only repaints the cells whose state differs from presented_cells, the
+	// states the target shows. Cells are painted inside the grid lines, so
+	// the lines are only drawn on a full redraw. The frame itself just
+	// copies the target to the screen.
+	void append_target_events(DrawingEventQueue& event_queue) {
+		CellReader& shown = cells();
+		int state_count = shown.get_state_count();
+		bool continuous = shown.has_continuous_cells();
+		if (full_redraw_needed) {
+			Uint8 dead_red, dead_green, dead_blue;
+			state_colour(0, state_count, continuous, dead_red, dead_green, dead_blue);
+			target_queue.rectangle_events.push_back(DrawingRectangleEvent({ 0, 0, grid_width, grid_height }, dead_red, dead_green, dead_blue, 255));
+			append_grid_lines(target_queue, 0, 0);
+			std::fill(presented_cells.begin(), presented_cells.end(), 0);
+			presented_bounds = { 0, 0, 0, 0 };
+		}
+		if (cells_changed || full_redraw_needed) {
+			// Outside both the live bounds and the cells shown last time, every
+			// cell is dead on screen and in the cells shown.
+			CellBox bounds = clip_to_visible(shown.get_live_bounds());
+			CellBox region = bounds;
+			if (!presented_bounds.is_empty()) {
+				region = bounds.is_empty() ? presented_bounds : CellBox{ std::min(bounds.top, presented_bounds.top), std::min(bounds.left, presented_bounds.left),
+					std::max(bounds.bottom, presented_bounds.bottom), std::max(bounds.right, presented_bounds.right) };
+			}
+			int region_width = region.right - region.left;
+			for (int r = region.top; r < region.bottom && region_width > 0; r++) {
+				shown.read_cells(r, region.left, 1, region_width, row_cells.data());
+				uint8_t* presented_row = &presented_cells[(size_t)r * visible_columns];
+				for (int c = region.left; c < region.right; c++) {
+					uint8_t state = row_cells[c - region.left];
+					if (state == presented_row[c]) {
+						continue;
+					}
+					presented_row[c] = state;
+					Uint8 red, green, blue;
+					state_colour(state, state_count, continuous, red, green, blue);
+					target_queue.batched_rectangle_events.push_back(DrawingRectangleEvent(cell_rect_inside_lines(r, c), red, green, blue, 255));
+				}
+			}
+			presented_bounds = bounds;
+		}
+		target_queue.begin_frame();
+		SDL_SetRenderTarget(renderer, grid_target);
+		target_queue.execute_drawing_events(*renderer);
+		SDL_SetRenderTarget(renderer, nullptr);
+
+		SDL_Rect grid_rect = { grid_top_left_x, grid_top_left_y, grid_width, grid_height };
+		event_queue.texture_events.push_back(DrawingTextureEvent(grid_target, grid_rect));
+	}
+
+	// Creates the render target on first use. Prints an error and returns
+	// false if SDL cannot.
+	bool create_grid_target() {
+		if (grid_target) {
+			return true;
+		}
+		if (grid_target_failed) {
+			return false;
+		}
+		grid_target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, grid_width, grid_height);
+		if (!grid_target) {
+			std::cout << "Error creating the grid render target, drawing every cell every frame: " << SDL_GetError() << std::endl;
+			grid_target_failed = true;
+			return false;
+		}
+		presented_cells.assign((size_t)visible_rows * visible_columns, 0);
+		full_redraw_needed = true;
+		cells_changed = true;
+		return true;
+	}
+
+	CellBox clip_to_visible(CellBox box) {
+		CellBox clipped = { box.top, box.left, std::min(box.bottom, visible_rows), std::min(box.right, visible_columns) };
+		return clipped.is_empty() ? CellBox{ 0, 0, 0, 0 } : clipped;
+	}
+
+	// A cell's rect in the render target, without the grid lines on its top
+	// and left edges.
+	SDL_Rect cell_rect_inside_lines(int r, int c) {
+		int line_left = c > 0 ? 1 : 0;
+		int line_top = r > 0 ? 1 : 0;
+		return { c * rect_width + line_left, r * rect_height + line_top, rect_width - line_left, rect_height - line_top };
+	}
+
+	// Uploads the visible cells into cell_texture and draws it over the grid
+	// area. No grid lines, the cells are too small for them. The texture
+	// keeps its contents, so it is only uploaded again when cells changed.
+	void append_texture_events(DrawingEventQueue& event_queue) {
+		if (needs_drawing() || !cell_texture.texture) {
+			int state_count = cells().get_state_count();
+			bool continuous = cells().has_continuous_cells();
+			for (int value = 0; value < 256; value++) {
+				Uint8 red, green, blue;
+				state_colour((uint8_t)value, state_count, continuous, red, green, blue);
+				cell_texture.palette[value] = CellTexture::texel(red, green, blue);
+			}
+			if (!cell_texture.update(*renderer, cells(), visible_rows, visible_columns)) {
+				return;
+			}
+		}
+		SDL_Rect grid_rect = { grid_top_left_x, grid_top_left_y, grid_width, grid_height };
+		event_queue.texture_events.push_back(DrawingTextureEvent(cell_texture.texture, grid_rect));
+	}
+
+	bool is_inside(int x, int y) {
+		return (x >= grid_top_left_x && x <= grid_top_left_x + width) && (y >= grid_top_left_y && y <= grid_top_left_y + height);
+	}
+
+	// Cell under the screen position (x, y), false if there is none.
+	bool get_cell_at(int x, int y, int& r, int& c) {
+		if (!is_inside(x, y)) {
+			return false;
+		}
+		int relative_x = x - grid_top_left_x;
+		int relative_y = y - grid_top_left_y;
+
+		// Proportional, so it also holds when the texture scales the cells down.
+		r = (int)((long long)relative_y * visible_rows / grid_height);
+		c = (int)((long long)relative_x * visible_columns / grid_width);
+		if (r >= visible_rows || c >= visible_columns) {
+			return false;
+		}
+
+		std::cout << "r: " << r << " c: " << c << std::endl;
+
+		return true;
+	}
+
+	SDL_Renderer* renderer;
+	int grid_top_left_x;
+	int grid_top_left_y;
+
+	int width;
+	int height;
+	int rows;
+	int columns;
+
+	int rect_width;
+	int rect_height;
+	int visible_rows;
+	int visible_columns;
+	// Pixels covered by the visible cells.
+	int grid_width;
+	int grid_height;
+
+	CellRendering cell_rendering;
+	CellTexture cell_texture;
+
+	// Set whenever the engine's cells may differ from what was last drawn.
+	bool cells_changed;
+	// Set when everything has to be drawn again, not just changed cells.
+	bool full_redraw_needed;
+	int presented_state_count;
+	bool presented_continuous;
+	// Persistent render target of the grid area for the rectangle path.
+	SDL_Texture* grid_target;
+	bool grid_target_failed;
+	// States grid_target shows, visible_rows x visible_columns.
+	std::vector<uint8_t> presented_cells;
+	// Box of the cells that are not dead in presented_cells.
+	CellBox presented_bounds;
+	// Draws into grid_target.
+	DrawingEventQueue target_queue;
+
+	EngineType engine_type;
+	std::unique_ptr<LifeEngine> engine;
+	// Runs the engine once started, declared after it so it stops first.
+	std::unique_ptr<SimulationThread> simulation;
+	// Generation of the engine and whether it steps continuously while no
+	// simulation thread holds it.
+	uint64_t generation;
+	bool simulation_running;
+	// Every step advances 2^step_log2 generations.
+	int step_log2;
+	// One row of cell states read back while drawing.
+	std::vector<uint8_t> row_cells;
+};
+
+class DrawingWindow {
+public:
+	DrawingWindow(int width1, int height1, int rows1, int columns1, EngineType engine_type) {
+		width = width1;
+		height = height1;
+		rows = rows1;
+		columns = columns1; 
+		
+		background_rect = { 0, 0, width, height };
+
+		int grid_side_length = std::min(background_rect.w, background_rect.h);
+
+		int grid_top_left_x = background_rect.x + (int)(0.2 * grid_side_length);
+		int grid_top_left_y = background_rect.y + (int)(0.2 * grid_side_length);
+
+		int grid_bottom_right_x = background_rect.x + (int)(0.8 * grid_side_length);
+		int grid_bottom_right_y = background_rect.y + (int)(0.8 * grid_side_length);
+
+
+		int drawing_grid_width = grid_bottom_right_x - grid_top_left_x;
+		int drawing_grid_height = grid_bottom_right_y - grid_top_left_y;
+
+		drawing_grid = std::make_unique<DrawingGrid>(grid_top_left_x, grid_top_left_y, drawing_grid_width, drawing_grid_height, rows, columns, engine_type);
+	}
+
+	bool is_inside(int x, int y) {
+		return (x >= background_rect.x && x <= background_rect.x + width) && (y >= background_rect.y && y <= background_rect.y + height);
+	}
+
+	bool is_inside_grid(int x, int y) {
+		return drawing_grid->is_inside(x, y);
+	}
+
+	bool get_cell_at(int x, int y, int& r, int& c) {
+		if (!is_inside_grid(x, y)) {
+			return false;
+		}
+		return drawing_grid->get_cell_at(x, y, r, c);
+	}
+
+	void append_drawing_events(DrawingEventQueue& event_queue) {
+		event_queue.rectangle_events.push_back(DrawingRectangleEvent(background_rect, 255, 255, 255, 255));
+
+		drawing_grid->append_drawing_events(event_queue);
+	}
+
+	int width;
+	int height;
+	int rows;
+	int columns;
+	SDL_Rect background_rect;
+	std::unique_ptr<DrawingGrid> drawing_grid;
+};
@@ -0,0 +1,181 @@
+#pragma once
+#include <cmath>
+#include <vector>
+
+// Complex arithmetic written out by hand: std::complex multiplication goes
+// through a library call for its NaN handling unless -ffast-math is on.
+struct Complex {
+	float re;
+	float im;
+};
+
+inline Complex operator+(Complex a, Complex b) {
+	return { a.re + b.re, a.im + b.im };
+}
+
+inline Complex operator-(Complex a, Complex b) {
+	return { a.re - b.re, a.im - b.im };
+}
+
+inline Complex operator*(Complex a, Complex b) {
+	return { a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+}
+
+inline Complex conjugate(Complex a) {
+	return { a.re, -a.im };
+}
+
+// In-place radix-2 FFT of one power-of-two size. The twiddle factors and the
+// bit-reversal permutation are computed once, transforms do not allocate.
+// Neither direction is normalized.
+class Fft {
+public:
+	Fft(int size1 = 1) {
+		size = size1;
+		twiddles.resize(size / 2 > 0 ? size / 2 : 1);
+		for (int k = 0; k < size / 2; k++) {
+			double angle = -2.0 * M_PI * k / size;
+			twiddles[k] = { (float)std::cos(angle), (float)std::sin(angle) };
+		}
+		bit_reversed.resize(size);
+		int bits = 0;
+		while ((1 << bits) < size) {
+			bits++;
+		}
+		for (int i = 0; i < size; i++) {
+			int reversed = 0;
+			for (int b = 0; b < bits; b++) {
+				reversed |= ((i >> b) & 1) << (bits - 1 - b);
+			}
+			bit_reversed[i] = reversed;
+		}
+	}
+
+	void transform(Complex* data, bool inverse) {
+		for (int i = 0; i < size; i++) {
+			int j = bit_reversed[i];
+			if (i < j) {
+				Complex t = data[i];
+				data[i] = data[j];
+				data[j] = t;
+			}
+		}
+		for (int half = 1; half < size; half *= 2) {
+			int step = size / (2 * half);
+			for (int start = 0; start < size; start += 2 * half) {
+				for (int k = 0; k < half; k++) {
+					Complex w = twiddles[k * step];
+					if (inverse) {
+						w = conjugate(w);
+					}
+					Complex even = data[start + k];
+					Complex odd = data[start + k + half] * w;
+					data[start + k] = even + odd;
+					data[start + k + half] = even - odd;
+				}
+			}
+		}
+	}
+
+	int size;
+	std::vector<Complex> twiddles;
+	std::vector<int> bit_reversed;
+};
+
+// 2D FFT of a real rows x columns array (both powers of two, columns at least
+// 2). Only the columns / 2 + 1 non-redundant columns of the spectrum are
+// kept: every row is transformed as a complex array of half the length (even
+// samples real, odd samples imaginary) and then split into the spectrum of
+// the real row, after which the spectrum columns get ordinary complex FFTs.
+//
+// The row and column passes are separate calls so a caller can spread them
+// over threads; rows and columns are independent within a pass. scratch
+// must hold rows complex values.
+class RealFft2D {
+public:
+	RealFft2D(int rows1 = 2, int columns1 = 2) : half_row_fft(columns1 / 2), column_fft(rows1) {
+		rows = rows1;
+		columns = columns1;
+		spectrum_columns = columns / 2 + 1;
+		split_twiddles.resize(columns / 2 + 1);
+		for (int k = 0; k <= columns / 2; k++) {
+			double angle = -2.0 * M_PI * k / columns;
+			split_twiddles[k] = { (float)std::cos(angle), (float)std::sin(angle) };
+		}
+	}
+
+	// Forward transform of one real row into its spectrum_columns values.
+	// out needs spectrum_columns entries, the first columns / 2 are also used
+	// as the half-length array.
+	void forward_row(const float* in, Complex* out) {
+		int half = columns / 2;
+		for (int k = 0; k < half; k++) {
+			out[k] = { in[2 * k], in[2 * k + 1] };
+		}
+		half_row_fft.transform(out, false);
+		// X[k] = E[k] + W^k O[k] with E, O the spectra of the even and odd samples.
+		Complex z0 = out[0];
+		out[0] = { z0.re + z0.im, 0 };
+		out[half] = { z0.re - z0.im, 0 };
+		for (int k = 1; k <= half / 2; k++) {
+			Complex a = out[k];
+			Complex b = conjugate(out[half - k]);
+			Complex even = { (a.re + b.re) * 0.5f, (a.im + b.im) * 0.5f };
+			Complex odd = { (a.im - b.im) * 0.5f, (b.re - a.re) * 0.5f };
+			Complex odd_twiddled = odd * split_twiddles[k];
+			Complex mirrored_odd = conjugate(odd) * split_twiddles[half - k];
+			out[k] = even + odd_twiddled;
+			out[half - k] = conjugate(even) + mirrored_odd;
+		}
+	}
+
+	// Inverse of forward_row, scaled by columns / 2. in is overwritten.
+	void inverse_row(Complex* in, float* out) {
+		int half = columns / 2;
+		Complex x0 = in[0];
+		Complex xh = in[half];
+		for (int k = 1; k <= half / 2; k++) {
+			Complex a = in[k];
+			Complex b = conjugate(in[half - k]);
+			Complex even = { (a.re + b.re) * 0.5f, (a.im + b.im) * 0.5f };
+			Complex odd = { (a.re - b.re) * 0.5f, (a.im - b.im) * 0.5f };
+			odd = odd * conjugate(split_twiddles[k]);
+			// Z[k] = E[k] + i O[k], and the same for half - k from the conjugates.
+			Complex mirrored_even = conjugate(even);
+			Complex mirrored_odd = conjugate(odd);
+			in[k] = { even.re - odd.im, even.im + odd.re };
+			in[half - k] = { mirrored_even.re - mirrored_odd.im, mirrored_even.im + mirrored_odd.re };
+		}
+		in[0] = { (x0.re + xh.re) * 0.5f, (x0.re - xh.re) * 0.5f };
+		half_row_fft.transform(in, true);
+		for (int k = 0; k < half; k++) {
+			out[2 * k] = in[k].re;
+			out[2 * k + 1] = in[k].im;
+		}
+	}
+
+	// Complex FFT of spectrum column c of a rows x spectrum_columns array.
+	void transform_column(Complex* spectrum, int c, bool inverse, Complex* scratch) {
+		for (int r = 0; r < rows; r++) {
+			scratch[r] = spectrum[(size_t)r * spectrum_columns + c];
+		}
+		column_fft.transform(scratch, inverse);
+		for (int r = 0; r < rows; r++) {
+			spectrum[(size_t)r * spectrum_columns + c] = scratch[r];
+		}
+	}
+
+	// Scale of a forward transform followed by the inverse passes.
+	float inverse_scale() {
+		return 1.0f / ((float)rows * (columns / 2));
+	}
+
+	int rows;
+	int columns;
+	int spectrum_columns;
+
+private:
+	Fft half_row_fft;
+	Fft column_fft;
+	std::vector<Complex> split_twiddles;
+};
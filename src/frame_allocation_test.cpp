@@ -0,0 +1,103 @@
+// Checks that drawing a frame does not touch the heap once the drawing
+// buffers are warm. Drives DrawingWindow::append_drawing_events and
+// DrawingEventQueue::execute_drawing_events on a software renderer, so no
+// window is needed, and exits non-zero if a steady-state frame allocates.
+// Usage: frame_allocation_test
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include <SDL.h>
+
+#include "drawing_window.h"
+
+// Heap allocations made through operator new on this thread. The simulation
+// steps between frames are not counted, only the drawing.
+static thread_local size_t heap_allocations = 0;
+
+void* operator new(size_t size) {
+	heap_allocations++;
+	void* memory = std::malloc(size > 0 ? size : 1);
+	if (!memory) {
+		std::abort();
+	}
+	return memory;
+}
+
+// Not inlined, GCC would otherwise see free() on memory from operator new
+// and warn about a mismatched deallocation.
+[[gnu::noinline]] void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, size_t) noexcept {
+	std::free(memory);
+}
+
+static const int WIDTH = 800;
+static const int HEIGHT = 600;
+static const int WARM_UP_FRAMES = 5;
+static const int STEADY_FRAMES = 200;
+
+// Draws a random soup on a rows x columns grid. Returns the number of
+// steady-state frames that allocated.
+int check_grid(SDL_Renderer& renderer, int rows, int columns, bool use_renderer) {
+	DrawingWindow window(WIDTH, HEIGHT, rows, columns, EngineType::Bitboard);
+	DrawingGrid& grid = *window.drawing_grid;
+	grid.renderer = use_renderer ? &renderer : nullptr;
+	std::mt19937 random(rows);
+	for (int r = 0; r < rows; r++) {
+		for (int c = 0; c < columns; c++) {
+			grid.engine->set_alive(r, c, random() % 3 == 0);
+		}
+	}
+
+	DrawingEventQueue queue;
+	int failed_frames = 0;
+	for (int frame = 0; frame < WARM_UP_FRAMES + STEADY_FRAMES; frame++) {
+		grid.updateGrid();
+		if (frame % 50 == 0) {
+			grid.invalidate();
+		}
+		size_t allocations_before = heap_allocations;
+		SDL_SetRenderDrawColor(&renderer, 255, 255, 255, 255);
+		SDL_RenderClear(&renderer);
+		queue.begin_frame();
+		window.append_drawing_events(queue);
+		queue.execute_drawing_events(renderer);
+		size_t allocations = heap_allocations - allocations_before;
+		if (frame >= WARM_UP_FRAMES && allocations > 0) {
+			std::cout << rows << "x" << columns << " frame " << frame << " made " << allocations << " heap allocations while drawing"
+				<< (queue.grew_this_frame() ? ", the drawing buffers grew." : ".") << std::endl;
+			failed_frames++;
+		}
+	}
+	std::cout << rows << "x" << columns << (use_renderer ? "" : " without render target")
+		<< (grid.cell_rendering == CellRendering::Texture ? ", texture" : ", rectangles") << ": "
+		<< STEADY_FRAMES - failed_frames << " of " << STEADY_FRAMES << " frames drawn without allocating." << std::endl;
+	return failed_frames;
+}
+
+int main(int argc, char** args) {
+	SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, WIDTH, HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+	if (!surface) {
+		std::cout << "Error creating the surface: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+	SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+	if (!renderer) {
+		std::cout << "Error creating the software renderer: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+	int failed_frames = 0;
+	// The persistent render target, the direct rectangle path and the
+	// streaming texture.
+	failed_frames += check_grid(*renderer, 20, 20, true);
+	failed_frames += check_grid(*renderer, 20, 20, false);
+	failed_frames += check_grid(*renderer, 300, 300, true);
+
+	SDL_DestroyRenderer(renderer);
+	SDL_FreeSurface(surface);
+	return failed_frames > 0 ? 1 : 0;
+}
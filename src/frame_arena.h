@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Storage for objects that only live for one frame, such as drawing events.
+// reset() drops the objects but keeps the memory, so once the arena has held
+// the most objects a frame needs, later frames append without allocating.
+// Appending past the capacity still works, it reallocates like a std::vector
+// and sets grew until the next begin_frame().
+template <typename T>
+class FrameArena {
+public:
+	FrameArena(size_t initial_capacity = 0) {
+		items.reserve(initial_capacity);
+		grew = false;
+	}
+
+	void push_back(const T& item) {
+		if (items.size() == items.capacity()) {
+			grew = true;
+		}
+		items.push_back(item);
+	}
+
+	void begin_frame() {
+		grew = false;
+	}
+
+	void reset() {
+		items.clear();
+	}
+
+	T* begin() {
+		return items.data();
+	}
+
+	T* end() {
+		return items.data() + items.size();
+	}
+
+	T* data() {
+		return items.data();
+	}
+
+	size_t size() {
+		return items.size();
+	}
+
+	bool empty() {
+		return items.empty();
+	}
+
+	// Did appending allocate since the last begin_frame().
+	bool grew;
+
+private:
+	std::vector<T> items;
+};
@@ -0,0 +1,319 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <SDL.h>
+
+#include "life_engine.h"
+#include "bitboard_kernels.h"
+#include "thread_pool.h"
+
+// Engine for Generations rules ("B2/S/C3" is Brian's Brain): a cell is dead
+// (0), alive (1) or dying (2..states - 1), and a dying cell ages by one state
+// per generation until it is dead again. Only live cells count as neighbours.
+//
+// The states are bit sliced: plane p holds bit p of the state of 64 cells per
+// uint64_t, in the same padded row layout as BitboardGrid, so 256 states need
+// only 8 bits per cell and small rules 2. A separate plane marks the live
+// cells; the neighbour count and birth / survive decision run on it with the
+// bitboard row kernels (and their SIMD versions), and the ageing of the other
+// states is a bit-sliced increment over whole rows.
+class GenerationsGrid : public LifeEngine {
+public:
+	static const int BAND_ROWS = 64;
+
+	GenerationsGrid(int rows1, int columns1) {
+		rows = rows1;
+		columns = columns1;
+
+		data_words = (columns + 63) / 64;
+		int words_per_vector = (int)(SDL_SIMDGetAlignment() / sizeof(uint64_t));
+		if (words_per_vector < 1) {
+			words_per_vector = 1;
+		}
+		words_per_row = (data_words + 2 + words_per_vector - 1) / words_per_vector * words_per_vector;
+		plane_words = (size_t)words_per_row * (rows + 2);
+
+		int remaining_bits = columns % 64;
+		last_word_mask = remaining_bits == 0 ? ~uint64_t(0) : (uint64_t(1) << remaining_bits) - 1;
+
+		boundary = Boundary::Dead;
+		alive = allocate_planes(1);
+		next_alive = allocate_planes(1);
+		plane_count = 0;
+		planes = nullptr;
+		next_planes = nullptr;
+		resize_planes(plane_count_for(rule.life_rule.states));
+
+		row_kernel = select_bitboard_row_kernel(rule.life_rule);
+		set_thread_count((int)std::thread::hardware_concurrency());
+	}
+
+	~GenerationsGrid() {
+		SDL_SIMDFree(alive);
+		SDL_SIMDFree(next_alive);
+		SDL_SIMDFree(planes);
+		SDL_SIMDFree(next_planes);
+	}
+
+	GenerationsGrid(const GenerationsGrid&) = delete;
+	GenerationsGrid& operator=(const GenerationsGrid&) = delete;
+
+	void step() override {
+		if (boundary != Boundary::Dead) {
+			fill_bitboard_halo(alive, words_per_row, rows, columns, boundary);
+		}
+		int bands = (rows + BAND_ROWS - 1) / BAND_ROWS;
+		thread_pool->parallel_for(bands, [this](int band, int worker) {
+			int first_row = band * BAND_ROWS + 1;
+			int last_row = std::min(first_row + BAND_ROWS - 1, rows);
+			for (int r = first_row; r <= last_row; r++) {
+				step_row(r, scratch[worker]);
+			}
+		});
+		std::swap(alive, next_alive);
+		std::swap(planes, next_planes);
+	}
+
+	void set_thread_count(int thread_count) {
+		thread_pool = std::make_unique<ThreadPool>(thread_count);
+		scratch.assign(thread_pool->get_thread_count(), RowScratch());
+		for (RowScratch& row_scratch : scratch) {
+			row_scratch.resize(words_per_row);
+		}
+	}
+
+	bool is_alive(int r, int c) override {
+		return get_state(r, c) == 1;
+	}
+
+	// Setting a cell alive or dead also clears a dying state.
+	void set_alive(int r, int c, bool alive1) override {
+		set_state(r, c, alive1 ? 1 : 0);
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	// Any rule the bitboard kernels can run, with any number of states.
+	bool set_rule(LifeRule rule1) override {
+		int new_plane_count = plane_count_for(rule1.states);
+		if (new_plane_count != plane_count) {
+			// Keep the cells, states the new rule does not have become dead.
+			std::vector<uint8_t> cells((size_t)rows * columns);
+			read_cells(0, 0, rows, columns, cells.data());
+			resize_planes(new_plane_count);
+			for (int r = 0; r < rows; r++) {
+				for (int c = 0; c < columns; c++) {
+					uint8_t state = cells[(size_t)r * columns + c];
+					set_state(r, c, state < rule1.states ? state : 0);
+				}
+			}
+		} else {
+			for (int r = 0; r < rows; r++) {
+				for (int c = 0; c < columns; c++) {
+					if (get_state(r, c) >= rule1.states) {
+						set_state(r, c, 0);
+					}
+				}
+			}
+		}
+		rule = BitboardRule(rule1);
+		row_kernel = select_bitboard_row_kernel(rule1);
+		return true;
+	}
+
+	LifeRule get_rule() override {
+		return rule.life_rule;
+	}
+
+	// Only live cells are counted, so only the live plane needs a halo.
+	bool set_boundary(Boundary boundary1) override {
+		boundary = boundary1;
+		fill_bitboard_halo(alive, words_per_row, rows, columns, boundary);
+		fill_bitboard_halo(next_alive, words_per_row, rows, columns, boundary);
+		return true;
+	}
+
+	Boundary get_boundary() override {
+		return boundary;
+	}
+
+	int get_state_count() override {
+		return rule.life_rule.states;
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		for (int dr = 0; dr < height; dr++) {
+			for (int dc = 0; dc < width; dc++) {
+				out[dr * width + dc] = get_state(r + dr, c + dc);
+			}
+		}
+	}
+
+	uint8_t get_state(int r, int c) {
+		size_t index = word_index(r, c);
+		int shift = c % 64;
+		uint8_t state = 0;
+		for (int p = 0; p < plane_count; p++) {
+			state |= ((planes[p * plane_words + index] >> shift) & 1) << p;
+		}
+		return state;
+	}
+
+	void set_state(int r, int c, uint8_t state) {
+		size_t index = word_index(r, c);
+		uint64_t bit = uint64_t(1) << (c % 64);
+		for (int p = 0; p < plane_count; p++) {
+			set_bit(planes[p * plane_words + index], bit, (state >> p) & 1);
+		}
+		set_bit(alive[index], bit, state == 1);
+	}
+
+	// Index of the word holding cell (r, c) in a plane, skipping the ghost row and word.
+	size_t word_index(int r, int c) {
+		return (size_t)(r + 1) * words_per_row + 1 + c / 64;
+	}
+
+	int rows;
+	int columns;
+
+	int data_words;
+	int words_per_row;
+	size_t plane_words;
+	uint64_t last_word_mask;
+
+	// Live cells, one plane. Allocated with SDL_SIMDAlloc, swapped after every step.
+	uint64_t* alive;
+	uint64_t* next_alive;
+	// plane_count planes of plane_words words each, plane p holds bit p of the states.
+	int plane_count;
+	uint64_t* planes;
+	uint64_t* next_planes;
+
+	BitboardRule rule;
+	BitboardRowKernel row_kernel;
+	Boundary boundary;
+
+	std::unique_ptr<ThreadPool> thread_pool;
+
+private:
+	// Per worker rows of intermediate results, so a step does not allocate.
+	struct RowScratch {
+		std::vector<uint64_t> born;
+		std::vector<uint64_t> occupied;
+		std::vector<uint64_t> carry;
+		std::vector<uint64_t> wraps;
+
+		void resize(int words) {
+			born.assign(words, 0);
+			occupied.assign(words, 0);
+			carry.assign(words, 0);
+			wraps.assign(words, 0);
+		}
+	};
+
+	// States 0..states - 1 need bit_width(states - 1) planes.
+	static int plane_count_for(int states) {
+		return std::max((int)std::bit_width((unsigned)(states - 1)), 1);
+	}
+
+	uint64_t* allocate_planes(int count) {
+		size_t bytes = count * plane_words * sizeof(uint64_t);
+		uint64_t* words = (uint64_t*)SDL_SIMDAlloc(bytes);
+		SDL_memset(words, 0, bytes);
+		return words;
+	}
+
+	void resize_planes(int count) {
+		SDL_SIMDFree(planes);
+		SDL_SIMDFree(next_planes);
+		plane_count = count;
+		planes = allocate_planes(plane_count);
+		next_planes = allocate_planes(plane_count);
+		SDL_memset(alive, 0, plane_words * sizeof(uint64_t));
+	}
+
+	static void set_bit(uint64_t& word, uint64_t bit, bool value) {
+		if (value) {
+			word |= bit;
+		} else {
+			word &= ~bit;
+		}
+	}
+
+	// Steps padded row r. Every loop below is a plain bitwise pass over the
+	// words of the row, which the compiler vectorizes.
+	void step_row(int r, RowScratch& row_scratch) {
+		size_t row_offset = (size_t)r * words_per_row;
+		const uint64_t* above = &alive[row_offset - words_per_row];
+		const uint64_t* middle = &alive[row_offset];
+		const uint64_t* below = &alive[row_offset + words_per_row];
+		uint64_t* born = row_scratch.born.data();
+		uint64_t* occupied = row_scratch.occupied.data();
+		uint64_t* carry = row_scratch.carry.data();
+		uint64_t* wraps = row_scratch.wraps.data();
+
+		// Cells the birth / survive rule wants alive, taking the live plane as
+		// the current generation.
+		row_kernel(above, middle, below, born, data_words, rule);
+		born[data_words] &= last_word_mask;
+
+		for (int w = 1; w <= data_words; w++) {
+			occupied[w] = 0;
+			carry[w] = ~uint64_t(0);
+			wraps[w] = ~uint64_t(0);
+		}
+		for (int p = 0; p < plane_count; p++) {
+			const uint64_t* plane = &planes[p * plane_words + row_offset];
+			for (int w = 1; w <= data_words; w++) {
+				occupied[w] |= plane[w];
+			}
+		}
+
+		// Dying cells cannot be born again, a cell comes alive only from
+		// state 0 or stays alive from state 1.
+		for (int w = 1; w <= data_words; w++) {
+			born[w] &= middle[w] | ~occupied[w];
+		}
+
+		// Every other occupied cell moves to the next state, and the state
+		// after the last one is dead. Alive cells that do not survive are
+		// state 1, so the increment takes them to state 2.
+		int states = rule.life_rule.states;
+		for (int p = 0; p < plane_count; p++) {
+			const uint64_t* plane = &planes[p * plane_words + row_offset];
+			uint64_t* next_plane = &next_planes[p * plane_words + row_offset];
+			uint64_t states_bit = ((states >> p) & 1) ? ~uint64_t(0) : 0;
+			for (int w = 1; w <= data_words; w++) {
+				uint64_t incremented = plane[w] ^ carry[w];
+				carry[w] &= plane[w];
+				wraps[w] &= ~(incremented ^ states_bit);
+				next_plane[w] = incremented;
+			}
+		}
+
+		for (int p = 0; p < plane_count; p++) {
+			uint64_t* next_plane = &next_planes[p * plane_words + row_offset];
+			uint64_t lives = p == 0 ? ~uint64_t(0) : 0;
+			for (int w = 1; w <= data_words; w++) {
+				uint64_t ageing = occupied[w] & ~born[w] & ~wraps[w];
+				next_plane[w] = (next_plane[w] & ageing) | (born[w] & lives);
+			}
+		}
+		SDL_memcpy(&next_alive[row_offset + 1], &born[1], data_words * sizeof(uint64_t));
+	}
+
+	std::vector<RowScratch> scratch;
+};
@@ -0,0 +1,187 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Storage layouts for per-cell grids. Every layout maps (r, c) to an offset
+// and visits the cells in storage order with traverse(), so loops over the
+// grid walk memory sequentially whatever the layout is.
+
+struct RowMajorLayout {
+	RowMajorLayout(int rows1, int columns1) : rows(rows1), columns(columns1) {}
+
+	size_t size() {
+		return (size_t)rows * columns;
+	}
+
+	size_t index(int r, int c) {
+		return (size_t)r * columns + c;
+	}
+
+	template <typename F>
+	void traverse(F f) {
+		for (int r = 0; r < rows; r++) {
+			for (int c = 0; c < columns; c++) {
+				f(r, c);
+			}
+		}
+	}
+
+	static const char* name() {
+		return "row-major";
+	}
+
+	int rows;
+	int columns;
+};
+
+struct ColumnMajorLayout {
+	ColumnMajorLayout(int rows1, int columns1) : rows(rows1), columns(columns1) {}
+
+	size_t size() {
+		return (size_t)rows * columns;
+	}
+
+	size_t index(int r, int c) {
+		return r + (size_t)c * rows;
+	}
+
+	template <typename F>
+	void traverse(F f) {
+		for (int c = 0; c < columns; c++) {
+			for (int r = 0; r < rows; r++) {
+				f(r, c);
+			}
+		}
+	}
+
+	static const char* name() {
+		return "column-major";
+	}
+
+	int rows;
+	int columns;
+};
+
+// 64 x 64 blocks stored one after another, row-major inside a block. The
+// grid is padded up to whole blocks.
+struct Tiled64Layout {
+	static const int TILE = 64;
+
+	Tiled64Layout(int rows1, int columns1) : rows(rows1), columns(columns1) {
+		tile_columns = (columns + TILE - 1) / TILE;
+		tile_rows = (rows + TILE - 1) / TILE;
+	}
+
+	size_t size() {
+		return (size_t)tile_rows * tile_columns * TILE * TILE;
+	}
+
+	size_t index(int r, int c) {
+		size_t tile = (size_t)(r / TILE) * tile_columns + c / TILE;
+		return tile * TILE * TILE + (r % TILE) * TILE + c % TILE;
+	}
+
+	template <typename F>
+	void traverse(F f) {
+		for (int tr = 0; tr < tile_rows; tr++) {
+			for (int tc = 0; tc < tile_columns; tc++) {
+				int last_r = (tr + 1) * TILE < rows ? (tr + 1) * TILE : rows;
+				int last_c = (tc + 1) * TILE < columns ? (tc + 1) * TILE : columns;
+				for (int r = tr * TILE; r < last_r; r++) {
+					for (int c = tc * TILE; c < last_c; c++) {
+						f(r, c);
+					}
+				}
+			}
+		}
+	}
+
+	static const char* name() {
+		return "tiled 64x64";
+	}
+
+	int rows;
+	int columns;
+	int tile_rows;
+	int tile_columns;
+};
+
+// Z-order: the bits of r and c are interleaved, so cells that are close in
+// both directions are close in memory. The grid is padded to a power-of-two
+// square.
+struct MortonLayout {
+	MortonLayout(int rows1, int columns1) : rows(rows1), columns(columns1) {
+		side = 1;
+		while (side < rows || side < columns) {
+			side *= 2;
+		}
+	}
+
+	size_t size() {
+		return (size_t)side * side;
+	}
+
+	size_t index(int r, int c) {
+		return (size_t)(spread_bits((uint32_t)c) | (spread_bits((uint32_t)r) << 1));
+	}
+
+	template <typename F>
+	void traverse(F f) {
+		traverse_block(0, 0, side, f);
+	}
+
+	// Visits the cells of the size x size block at (r0, c0) in Morton order.
+	// Blocks entirely outside the grid are skipped, blocks partly outside are
+	// split into their quadrants, so only cells of the grid are visited.
+	template <typename F>
+	void traverse_block(int r0, int c0, int size, F& f) {
+		if (r0 >= rows || c0 >= columns) {
+			return;
+		}
+		if (r0 + size > rows || c0 + size > columns) {
+			int half = size / 2;
+			traverse_block(r0, c0, half, f);
+			traverse_block(r0, c0 + half, half, f);
+			traverse_block(r0 + half, c0, half, f);
+			traverse_block(r0 + half, c0 + half, half, f);
+			return;
+		}
+		// Going from code i to i + 1 clears the trailing ones of i, which
+		// are the low bits of both coordinates, and sets the next bit, which
+		// belongs to c when its position is even and to r when it is odd.
+		int dr = 0;
+		int dc = 0;
+		uint64_t cells = (uint64_t)size * size;
+		for (uint64_t i = 0; i < cells; i++) {
+			f(r0 + dr, c0 + dc);
+			int carry = std::countr_one(i);
+			dc &= ~((1 << (carry + 1) / 2) - 1);
+			dr &= ~((1 << carry / 2) - 1);
+			if (carry % 2 == 0) {
+				dc += 1 << carry / 2;
+			} else {
+				dr += 1 << carry / 2;
+			}
+		}
+	}
+
+	static const char* name() {
+		return "Morton";
+	}
+
+	// Moves bit k of x to bit 2k.
+	static uint64_t spread_bits(uint32_t x) {
+		uint64_t v = x;
+		v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+		v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+		v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+		v = (v | (v << 2)) & 0x3333333333333333ull;
+		v = (v | (v << 1)) & 0x5555555555555555ull;
+		return v;
+	}
+
+	int rows;
+	int columns;
+	int side;
+};
@@ -0,0 +1,520 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "life_engine.h"
+
+// Quadtree node. Level 0 nodes are single cells, a node at level k covers
+// 2^k x 2^k cells. Nodes are hash-consed, so equal subtrees are shared and
+// the memoized result is computed once for every distinct subtree.
+struct HashLifeNode {
+	HashLifeNode* nw;
+	HashLifeNode* ne;
+	HashLifeNode* sw;
+	HashLifeNode* se;
+
+	// Centered level - 1 node advanced by min(2^(level - 2), 2^step_log2)
+	// generations, nullptr until computed.
+	HashLifeNode* result;
+	// Next node in the same hash bucket.
+	HashLifeNode* next;
+
+	uint64_t population;
+	int level;
+	// Set while the garbage collector marks reachable nodes.
+	bool marked;
+};
+
+struct HashLifeGcStats {
+	int collections{ 0 };
+	size_t nodes_before{ 0 };
+	size_t nodes_after{ 0 };
+	double last_pause_ms{ 0 };
+	double max_pause_ms{ 0 };
+	double total_pause_ms{ 0 };
+};
+
+// Hash-consed quadtree engine (Gosper's HashLife). The DrawingGrid sees a
+// rows x columns viewport of an unbounded plane, whose top left corner is
+// viewport_top/viewport_left in universe coordinates.
+//
+// The node table is bounded by max_memory_bytes: once it is full, nodes that
+// are no longer reachable from the root or from a computation in progress are
+// swept, and memoized results pointing at swept nodes are dropped and simply
+// recomputed when needed again.
+class HashLifeGrid : public LifeEngine {
+public:
+	HashLifeGrid(int rows1, int columns1, size_t max_memory_bytes1 = size_t(256) << 20) {
+		rows = rows1;
+		columns = columns1;
+		viewport_top = 0;
+		viewport_left = 0;
+
+		generation = 0;
+		step_log2 = 0;
+		node_count = 0;
+		buckets.assign(1 << 16, nullptr);
+		set_memory_limit(max_memory_bytes1);
+
+		dead_leaf = new HashLifeNode{ nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, false };
+		alive_leaf = new HashLifeNode{ nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 1, 0, false };
+		empty_nodes.push_back(dead_leaf);
+
+		root = empty_node(3);
+	}
+
+	~HashLifeGrid() {
+		for (HashLifeNode* bucket : buckets) {
+			while (bucket) {
+				HashLifeNode* next = bucket->next;
+				delete bucket;
+				bucket = next;
+			}
+		}
+		delete dead_leaf;
+		delete alive_leaf;
+	}
+
+	HashLifeGrid(const HashLifeGrid&) = delete;
+	HashLifeGrid& operator=(const HashLifeGrid&) = delete;
+
+	void step() override {
+		step_pow2(0);
+	}
+
+	// Advance the universe by 2^k generations in a single call.
+	void step_pow2(int k) override {
+		set_step_log2(k);
+
+		// The result of a level L node is only exact for 2^(L - 2) generations
+		// and covers the center half, so pad until the pattern sits in the
+		// center quarter and the root is big enough for the step.
+		while (root->level < k + 3 || !is_padded(root)) {
+			root = expand(root);
+		}
+		root = advance(root);
+		generation += uint64_t(1) << k;
+	}
+
+	bool is_alive(int r, int c) override {
+		return get_cell(viewport_top + r, viewport_left + c);
+	}
+
+	void set_alive(int r, int c, bool alive) override {
+		set_cell(viewport_top + r, viewport_left + c, alive);
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	// B0 would turn the infinite empty background on, which the quadtree
+	// cannot represent. Memoized results belong to the old rule.
+	bool set_rule(LifeRule rule1) override {
+		if (rule1.is_generations()) {
+			std::cout << "HashLife cannot run " << rule1.to_string() << ", Generations rules need the Generations engine." << std::endl;
+			return false;
+		}
+		if (rule1.births_on_empty()) {
+			std::cout << "HashLife cannot run " << rule1.to_string() << ", rules with B0 are not supported." << std::endl;
+			return false;
+		}
+		rule = rule1;
+		clear_results();
+		return true;
+	}
+
+	LifeRule get_rule() override {
+		return rule;
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		std::memset(out, 0, (size_t)height * width);
+		int64_t half = int64_t(1) << (root->level - 1);
+		read_viewport(root, -half, -half, viewport_top + r, viewport_left + c, height, width, out);
+	}
+
+	bool get_cell(int64_t y, int64_t x) {
+		HashLifeNode* node = root;
+		int64_t half = int64_t(1) << (node->level - 1);
+		if (y < -half || y >= half || x < -half || x >= half) {
+			return false;
+		}
+		y += half;
+		x += half;
+		while (node->level > 0) {
+			if (node->population == 0) {
+				return false;
+			}
+			int64_t child_half = int64_t(1) << (node->level - 1);
+			bool south = y >= child_half;
+			bool east = x >= child_half;
+			node = south ? (east ? node->se : node->sw) : (east ? node->ne : node->nw);
+			y -= south ? child_half : 0;
+			x -= east ? child_half : 0;
+		}
+		return node == alive_leaf;
+	}
+
+	void set_cell(int64_t y, int64_t x, bool alive) {
+		while (true) {
+			int64_t half = int64_t(1) << (root->level - 1);
+			if (y >= -half && y < half && x >= -half && x < half) {
+				root = set_cell(root, y + half, x + half, alive);
+				return;
+			}
+			root = expand(root);
+		}
+	}
+
+	uint64_t get_population() {
+		return root->population;
+	}
+
+	// Every node costs its own size plus roughly one hash bucket.
+	void set_memory_limit(size_t bytes) {
+		max_memory_bytes = bytes;
+		max_nodes = bytes / (sizeof(HashLifeNode) + sizeof(HashLifeNode*));
+		gc_threshold = max_nodes;
+	}
+
+	size_t get_memory_usage() {
+		return node_count * sizeof(HashLifeNode) + buckets.size() * sizeof(HashLifeNode*);
+	}
+
+	// Node table size and gc_stats, collections are only mentioned once
+	// there has been one.
+	std::string describe_stats() override {
+		std::ostringstream text;
+		text << "HashLife: " << node_count << " nodes, " << get_memory_usage() / 1024 << " of " << max_memory_bytes / 1024 << " KB";
+		if (gc_stats.collections > 0) {
+			text << ", " << gc_stats.collections << " GCs, last " << gc_stats.nodes_before << " -> " << gc_stats.nodes_after << " nodes in "
+				<< gc_stats.last_pause_ms << " ms, max " << gc_stats.max_pause_ms << " ms, total " << gc_stats.total_pause_ms << " ms";
+		}
+		return text.str();
+	}
+
+	// Mark everything reachable from the root, the cached empty nodes and the
+	// nodes of computations in progress, then free the rest.
+	void collect_garbage() {
+		auto start = std::chrono::steady_clock::now();
+		size_t nodes_before = node_count;
+
+		mark(root);
+		for (HashLifeNode* node : empty_nodes) {
+			mark(node);
+		}
+		for (HashLifeNode* node : gc_roots) {
+			mark(node);
+		}
+
+		// Drop memoized results that are about to be swept, results are never leaves.
+		for (HashLifeNode* bucket : buckets) {
+			for (HashLifeNode* node = bucket; node; node = node->next) {
+				if (node->marked && node->result && !node->result->marked) {
+					node->result = nullptr;
+				}
+			}
+		}
+		for (HashLifeNode*& bucket : buckets) {
+			HashLifeNode** link = &bucket;
+			while (*link) {
+				HashLifeNode* node = *link;
+				if (node->marked) {
+					node->marked = false;
+					link = &node->next;
+				} else {
+					*link = node->next;
+					delete node;
+					node_count--;
+				}
+			}
+		}
+
+		// If most of the table is live, collecting again right away would only
+		// thrash, so let it grow by a quarter of the limit first.
+		gc_threshold = node_count + max_nodes / 4 > max_nodes ? node_count + max_nodes / 4 : max_nodes;
+
+		double pause_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		gc_stats.collections++;
+		gc_stats.nodes_before = nodes_before;
+		gc_stats.nodes_after = node_count;
+		gc_stats.last_pause_ms = pause_ms;
+		gc_stats.total_pause_ms += pause_ms;
+		if (pause_ms > gc_stats.max_pause_ms) {
+			gc_stats.max_pause_ms = pause_ms;
+		}
+	}
+
+	int rows;
+	int columns;
+	int64_t viewport_top;
+	int64_t viewport_left;
+
+	uint64_t generation;
+	size_t node_count;
+
+	size_t max_memory_bytes;
+	HashLifeGcStats gc_stats;
+
+	LifeRule rule;
+
+protected:
+	void set_step_log2(int k) {
+		if (k == step_log2) {
+			return;
+		}
+		// Memoized results are only valid for the step size they were computed with.
+		clear_results();
+		step_log2 = k;
+	}
+
+	void clear_results() {
+		for (HashLifeNode* bucket : buckets) {
+			for (HashLifeNode* node = bucket; node; node = node->next) {
+				node->result = nullptr;
+			}
+		}
+	}
+
+	HashLifeNode* join(HashLifeNode* nw, HashLifeNode* ne, HashLifeNode* sw, HashLifeNode* se) {
+		size_t h = hash(nw, ne, sw, se) & (buckets.size() - 1);
+		for (HashLifeNode* node = buckets[h]; node; node = node->next) {
+			if (node->nw == nw && node->ne == ne && node->sw == sw && node->se == se) {
+				return node;
+			}
+		}
+
+		HashLifeNode* node = new HashLifeNode{ nw, ne, sw, se, nullptr, buckets[h],
+			nw->population + ne->population + sw->population + se->population, nw->level + 1, false };
+		buckets[h] = node;
+		node_count++;
+		if (node_count > buckets.size()) {
+			rehash(buckets.size() * 2);
+		}
+		return node;
+	}
+
+	HashLifeNode* empty_node(int level) {
+		while ((int)empty_nodes.size() <= level) {
+			HashLifeNode* child = empty_nodes.back();
+			empty_nodes.push_back(join(child, child, child, child));
+		}
+		return empty_nodes[level];
+	}
+
+	// Same cells in a node one level up, centered on the old one.
+	HashLifeNode* expand(HashLifeNode* node) {
+		HashLifeNode* empty = empty_node(node->level - 1);
+		return join(
+			join(empty, empty, empty, node->nw),
+			join(empty, empty, node->ne, empty),
+			join(empty, node->sw, empty, empty),
+			join(node->se, empty, empty, empty));
+	}
+
+	// True if every live cell lies in the center quarter of the node.
+	bool is_padded(HashLifeNode* node) {
+		return node->population ==
+			node->nw->se->se->population + node->ne->sw->sw->population +
+			node->sw->ne->ne->population + node->se->nw->nw->population;
+	}
+
+	HashLifeNode* center(HashLifeNode* node) {
+		return join(node->nw->se, node->ne->sw, node->sw->ne, node->se->nw);
+	}
+
+	void mark(HashLifeNode* node) {
+		if (node->level == 0 || node->marked) {
+			return;
+		}
+		node->marked = true;
+		mark(node->nw);
+		mark(node->ne);
+		mark(node->sw);
+		mark(node->se);
+	}
+
+	// advance() only collects on entry. Every node a caller still needs after
+	// the call returns must be on gc_roots at that point.
+	HashLifeNode* advance(HashLifeNode* node) {
+		if (node->result) {
+			return node->result;
+		}
+		if (node_count >= gc_threshold) {
+			gc_roots.push_back(node);
+			collect_garbage();
+			gc_roots.pop_back();
+		}
+		if (node->population == 0) {
+			node->result = empty_node(node->level - 1);
+			return node->result;
+		}
+		if (node->level == 2) {
+			node->result = advance_base(node);
+			return node->result;
+		}
+
+		size_t gc_roots_size = gc_roots.size();
+		gc_roots.push_back(node);
+
+		// Nine overlapping subnodes one level down. The middle ones are new
+		// nodes, so they are kept alive until their results are joined.
+		HashLifeNode* n01 = join(node->nw->ne, node->ne->nw, node->nw->se, node->ne->sw);
+		HashLifeNode* n10 = join(node->nw->sw, node->nw->se, node->sw->nw, node->sw->ne);
+		HashLifeNode* n11 = center(node);
+		HashLifeNode* n12 = join(node->ne->sw, node->ne->se, node->se->nw, node->se->ne);
+		HashLifeNode* n21 = join(node->sw->ne, node->se->nw, node->sw->se, node->se->sw);
+		gc_roots.insert(gc_roots.end(), { n01, n10, n11, n12, n21 });
+
+		HashLifeNode* r00 = advance_rooted(node->nw);
+		HashLifeNode* r01 = advance_rooted(n01);
+		HashLifeNode* r02 = advance_rooted(node->ne);
+		HashLifeNode* r10 = advance_rooted(n10);
+		HashLifeNode* r11 = advance_rooted(n11);
+		HashLifeNode* r12 = advance_rooted(n12);
+		HashLifeNode* r20 = advance_rooted(node->sw);
+		HashLifeNode* r21 = advance_rooted(n21);
+		HashLifeNode* r22 = advance_rooted(node->se);
+
+		HashLifeNode* a = join(r00, r01, r10, r11);
+		HashLifeNode* b = join(r01, r02, r11, r12);
+		HashLifeNode* c = join(r10, r11, r20, r21);
+		HashLifeNode* d = join(r11, r12, r21, r22);
+		gc_roots.insert(gc_roots.end(), { a, b, c, d });
+
+		HashLifeNode* result;
+		if (step_log2 >= node->level - 2) {
+			// Full speed: the second half of the 2^(level - 2) generations.
+			HashLifeNode* ra = advance_rooted(a);
+			HashLifeNode* rb = advance_rooted(b);
+			HashLifeNode* rc = advance_rooted(c);
+			HashLifeNode* rd = advance_rooted(d);
+			result = join(ra, rb, rc, rd);
+		} else {
+			// The first pass already did the whole step, only recenter.
+			result = join(center(a), center(b), center(c), center(d));
+		}
+		node->result = result;
+		gc_roots.resize(gc_roots_size);
+		return result;
+	}
+
+	// advance() whose result stays on gc_roots until the caller's frame is done.
+	HashLifeNode* advance_rooted(HashLifeNode* node) {
+		HashLifeNode* result = advance(node);
+		gc_roots.push_back(result);
+		return result;
+	}
+
+	// Level 2 (4x4) node to its centered 2x2 cells one generation later.
+	HashLifeNode* advance_base(HashLifeNode* node) {
+		int cells[4][4];
+		HashLifeNode* quadrants[2][2] = { { node->nw, node->ne }, { node->sw, node->se } };
+		for (int qy = 0; qy < 2; qy++) {
+			for (int qx = 0; qx < 2; qx++) {
+				HashLifeNode* q = quadrants[qy][qx];
+				cells[qy * 2][qx * 2] = q->nw == alive_leaf;
+				cells[qy * 2][qx * 2 + 1] = q->ne == alive_leaf;
+				cells[qy * 2 + 1][qx * 2] = q->sw == alive_leaf;
+				cells[qy * 2 + 1][qx * 2 + 1] = q->se == alive_leaf;
+			}
+		}
+
+		HashLifeNode* next[2][2];
+		for (int y = 1; y <= 2; y++) {
+			for (int x = 1; x <= 2; x++) {
+				int neighbourhood = 0;
+				for (int dy = -1; dy <= 1; dy++) {
+					for (int dx = -1; dx <= 1; dx++) {
+						neighbourhood |= cells[y + dy][x + dx] << (3 * (dy + 1) + dx + 1);
+					}
+				}
+				bool alive = rule.next_state_of(neighbourhood);
+				next[y - 1][x - 1] = alive ? alive_leaf : dead_leaf;
+			}
+		}
+		return join(next[0][0], next[0][1], next[1][0], next[1][1]);
+	}
+
+	// y and x are relative to the top left corner of the node.
+	HashLifeNode* set_cell(HashLifeNode* node, int64_t y, int64_t x, bool alive) {
+		if (node->level == 0) {
+			return alive ? alive_leaf : dead_leaf;
+		}
+		int64_t half = int64_t(1) << (node->level - 1);
+		if (y < half) {
+			if (x < half) {
+				return join(set_cell(node->nw, y, x, alive), node->ne, node->sw, node->se);
+			}
+			return join(node->nw, set_cell(node->ne, y, x - half, alive), node->sw, node->se);
+		}
+		if (x < half) {
+			return join(node->nw, node->ne, set_cell(node->sw, y - half, x, alive), node->se);
+		}
+		return join(node->nw, node->ne, node->sw, set_cell(node->se, y - half, x - half, alive));
+	}
+
+	void read_viewport(HashLifeNode* node, int64_t node_top, int64_t node_left,
+		int64_t top, int64_t left, int height, int width, uint8_t* out) {
+		if (node->population == 0) {
+			return;
+		}
+		int64_t size = int64_t(1) << node->level;
+		if (node_top >= top + height || node_top + size <= top || node_left >= left + width || node_left + size <= left) {
+			return;
+		}
+		if (node->level == 0) {
+			out[(node_top - top) * width + (node_left - left)] = 1;
+			return;
+		}
+		int64_t half = size / 2;
+		read_viewport(node->nw, node_top, node_left, top, left, height, width, out);
+		read_viewport(node->ne, node_top, node_left + half, top, left, height, width, out);
+		read_viewport(node->sw, node_top + half, node_left, top, left, height, width, out);
+		read_viewport(node->se, node_top + half, node_left + half, top, left, height, width, out);
+	}
+
+	static size_t hash(HashLifeNode* nw, HashLifeNode* ne, HashLifeNode* sw, HashLifeNode* se) {
+		size_t h = (size_t)(uintptr_t)nw;
+		h = h * 1000003 ^ (size_t)(uintptr_t)ne;
+		h = h * 1000003 ^ (size_t)(uintptr_t)sw;
+		h = h * 1000003 ^ (size_t)(uintptr_t)se;
+		return h ^ (h >> 17);
+	}
+
+	void rehash(size_t new_size) {
+		std::vector<HashLifeNode*> new_buckets(new_size, nullptr);
+		for (HashLifeNode* bucket : buckets) {
+			while (bucket) {
+				HashLifeNode* next = bucket->next;
+				size_t h = hash(bucket->nw, bucket->ne, bucket->sw, bucket->se) & (new_size - 1);
+				bucket->next = new_buckets[h];
+				new_buckets[h] = bucket;
+				bucket = next;
+			}
+		}
+		buckets.swap(new_buckets);
+	}
+
+	HashLifeNode* root;
+	HashLifeNode* dead_leaf;
+	HashLifeNode* alive_leaf;
+	std::vector<HashLifeNode*> empty_nodes;
+	std::vector<HashLifeNode*> buckets;
+	int step_log2;
+
+	size_t max_nodes;
+	size_t gc_threshold;
+	// Nodes held by advance() frames that are still running.
+	std::vector<HashLifeNode*> gc_roots;
+};
@@ -0,0 +1,146 @@
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "life_engine.h"
+
+// Keeps the neighbourhood of every cell between generations and only touches
+// cells near the ones that changed, so a step costs time proportional to the
+// number of births and deaths instead of to the grid size.
+//
+// Every cell stores its 3x3 block as the 9-bit LifeRule::table index (the
+// neighbour count of totalistic rules, generalized so non-totalistic rules
+// work too). When a cell is born or dies it flips its bit in the blocks of
+// itself and its eight neighbours, and those cells go on the candidate list.
+// A step evaluates only the candidates: a cell whose block did not change
+// since it was last evaluated already is in the state the rule gives it.
+//
+// Cells are stored row-major with a one cell dead halo, so flipping a cell on
+// the edge needs no bounds checks. Halo cells are marked as permanently
+// queued, which keeps them off the candidate list.
+class IncrementalGrid : public LifeEngine {
+public:
+	IncrementalGrid(int rows1, int columns1) {
+		rows = rows1;
+		columns = columns1;
+		stride = columns + 2;
+		size_t padded_size = (size_t)(rows + 2) * stride;
+		cells.assign(padded_size, 0);
+		neighbourhoods.assign(padded_size, 0);
+		queued.assign(padded_size, 1);
+		// Every cell starts as a candidate, a B0 rule turns on an empty grid.
+		for (int r = 0; r < rows; r++) {
+			for (int c = 0; c < columns; c++) {
+				candidates.push_back((uint32_t)index(r, c));
+			}
+		}
+	}
+
+	void step() override {
+		// All candidates are decided on the current generation before any
+		// cell flips.
+		changes.clear();
+		for (uint32_t i : candidates) {
+			queued[i] = 0;
+			if (rule.next_state_of(neighbourhoods[i]) != cells[i]) {
+				changes.push_back(i);
+			}
+		}
+		candidates.clear();
+		for (uint32_t i : changes) {
+			flip(i);
+		}
+	}
+
+	bool is_alive(int r, int c) override {
+		return cells[index(r, c)];
+	}
+
+	void set_alive(int r, int c, bool alive) override {
+		size_t i = index(r, c);
+		if (cells[i] != alive) {
+			flip((uint32_t)i);
+		}
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	bool set_rule(LifeRule rule1) override {
+		if (rule1.is_generations()) {
+			std::cout << "IncrementalGrid cannot run " << rule1.to_string() << ", Generations rules need the Generations engine." << std::endl;
+			return false;
+		}
+		rule = rule1;
+		// Blocks that were stable under the old rule may not be under the new one.
+		queue_all();
+		return true;
+	}
+
+	LifeRule get_rule() override {
+		return rule;
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		for (int dr = 0; dr < height; dr++) {
+			const uint8_t* row = &cells[index(r + dr, c)];
+			for (int dc = 0; dc < width; dc++) {
+				out[dr * width + dc] = row[dc];
+			}
+		}
+	}
+
+	// Padded index of grid cell (r, c).
+	size_t index(int r, int c) {
+		return (size_t)(r + 1) * stride + c + 1;
+	}
+
+	int rows;
+	int columns;
+	int stride;
+
+	LifeRule rule;
+	std::vector<uint8_t> cells;
+	// 3x3 block of every cell, bit 3 * (dr + 1) + dc + 1 is cell (r + dr, c + dc).
+	std::vector<uint16_t> neighbourhoods;
+	// Set for cells on the candidate list and for the halo.
+	std::vector<uint8_t> queued;
+	// Cells to evaluate in the next step, padded indices.
+	std::vector<uint32_t> candidates;
+	// Cells the last step flipped, padded indices.
+	std::vector<uint32_t> changes;
+
+private:
+	// Cell i sits at offset (-dr, -dc) from the block of cell i - dr * stride - dc.
+	void flip(uint32_t i) {
+		cells[i] ^= 1;
+		for (int dr = -1; dr <= 1; dr++) {
+			for (int dc = -1; dc <= 1; dc++) {
+				uint32_t n = i - dr * stride - dc;
+				neighbourhoods[n] ^= 1 << (3 * (dr + 1) + dc + 1);
+				if (!queued[n]) {
+					queued[n] = 1;
+					candidates.push_back(n);
+				}
+			}
+		}
+	}
+
+	void queue_all() {
+		for (int r = 0; r < rows; r++) {
+			for (int c = 0; c < columns; c++) {
+				size_t i = index(r, c);
+				if (!queued[i]) {
+					queued[i] = 1;
+					candidates.push_back((uint32_t)i);
+				}
+			}
+		}
+	}
+};
@@ -0,0 +1,210 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "life_engine.h"
+#include "larger_than_life_rule.h"
+#include "thread_pool.h"
+
+// Engine for Larger than Life rules, one byte of state per cell.
+//
+// Every step first builds a summed-area table of the live cells: sums[i][j] is
+// the number of live cells above row i and left of column j of the grid padded
+// with radius dead cells on every side. The count of any square is then four
+// lookups, so a step costs the same per cell for every radius and the padding
+// removes all border checks. The table is built in two parallel passes (prefix
+// sums along the rows, then down the columns) and the cells are updated in
+// parallel bands of rows.
+class LargerThanLifeGrid : public LifeEngine {
+public:
+	static const int BAND_ROWS = 16;
+	static const int MIN_CHUNK_COLUMNS = 256;
+
+	LargerThanLifeGrid(int rows1, int columns1) {
+		rows = rows1;
+		columns = columns1;
+		cells.assign((size_t)rows * columns, 0);
+		next_cells.assign((size_t)rows * columns, 0);
+		resize_sums();
+		fill_transitions();
+		thread_pool = std::make_unique<ThreadPool>((int)std::thread::hardware_concurrency());
+	}
+
+	void step() override {
+		build_sums();
+		int bands = (rows + BAND_ROWS - 1) / BAND_ROWS;
+		thread_pool->parallel_for(bands, [this](int band, int worker) {
+			int last_row = std::min((band + 1) * BAND_ROWS, rows);
+			for (int r = band * BAND_ROWS; r < last_row; r++) {
+				step_row(r);
+			}
+		});
+		cells.swap(next_cells);
+	}
+
+	void set_thread_count(int thread_count) {
+		thread_pool = std::make_unique<ThreadPool>(thread_count);
+	}
+
+	bool is_alive(int r, int c) override {
+		return cells[(size_t)r * columns + c] == 1;
+	}
+
+	// Setting a cell alive or dead also clears a dying state.
+	void set_alive(int r, int c, bool alive) override {
+		cells[(size_t)r * columns + c] = alive ? 1 : 0;
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	// Runs a life-like rule as its radius 1 Larger than Life rule.
+	bool set_rule(LifeRule rule1) override {
+		if (rule1.non_totalistic) {
+			std::cout << "Larger than Life cannot run " << rule1.to_string() << ", the rule is not totalistic." << std::endl;
+			return false;
+		}
+		life_rule = rule1;
+		set_larger_than_life_rule(LargerThanLifeRule(rule1));
+		return true;
+	}
+
+	// The last rule passed to set_rule, Conway before that. Rules set with
+	// set_larger_than_life_rule have no LifeRule equivalent.
+	LifeRule get_rule() override {
+		return life_rule;
+	}
+
+	void set_larger_than_life_rule(LargerThanLifeRule rule1) {
+		rule = rule1;
+		for (uint8_t& cell : cells) {
+			if (cell >= rule.states) {
+				cell = 0;
+			}
+		}
+		resize_sums();
+		fill_transitions();
+	}
+
+	LargerThanLifeRule get_larger_than_life_rule() {
+		return rule;
+	}
+
+	int get_state_count() override {
+		return rule.states;
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		for (int dr = 0; dr < height; dr++) {
+			std::copy_n(&cells[(size_t)(r + dr) * columns + c], width, &out[dr * width]);
+		}
+	}
+
+	int rows;
+	int columns;
+
+	LargerThanLifeRule rule;
+	LifeRule life_rule;
+
+	// State of every cell, row-major: 0 dead, 1 alive, 2.. dying.
+	std::vector<uint8_t> cells;
+	std::vector<uint8_t> next_cells;
+
+	// Summed-area table of the padded grid, sum_rows x sum_columns. The
+	// counts fit in 32 bits for any grid that fits in memory, and the
+	// differences of four entries are exact even where the entries wrap.
+	int sum_rows;
+	int sum_columns;
+	std::vector<uint32_t> sums;
+
+	// Next state by state and count, transitions[state * count_stride + count].
+	// The count is that of the whole square, the cell itself included, so
+	// the update needs no branches.
+	int count_stride;
+	std::vector<uint8_t> transitions;
+
+	std::unique_ptr<ThreadPool> thread_pool;
+
+private:
+	void resize_sums() {
+		sum_rows = rows + 2 * rule.radius + 1;
+		sum_columns = columns + 2 * rule.radius + 1;
+		sums.assign((size_t)sum_rows * sum_columns, 0);
+	}
+
+	void fill_transitions() {
+		count_stride = rule.max_count();
+		transitions.assign((size_t)rule.states * count_stride, 0);
+		int middle = rule.include_middle ? 0 : 1;
+		for (int n = 0; n < count_stride; n++) {
+			transitions[n] = rule.birth[n];
+			if (n >= middle) {
+				transitions[count_stride + n] = rule.survive[n - middle] ? 1 : (rule.states > 2 ? 2 : 0);
+			}
+			for (int state = 2; state < rule.states; state++) {
+				transitions[(size_t)state * count_stride + n] = state + 1 == rule.states ? 0 : state + 1;
+			}
+		}
+	}
+
+	void build_sums() {
+		int radius = rule.radius;
+		// Prefix sums along the rows that hold grid cells, the padding rows
+		// stay zero. Column j of row i covers cells up to column j - 1 - radius.
+		thread_pool->parallel_for(rows, [this, radius](int r, int worker) {
+			uint32_t* row = &sums[(size_t)(r + radius + 1) * sum_columns];
+			const uint8_t* cell_row = &cells[(size_t)r * columns];
+			uint32_t running = 0;
+			for (int c = 0; c < columns; c++) {
+				running += cell_row[c] == 1;
+				row[c + radius + 1] = running;
+			}
+			std::fill(row + columns + radius + 1, row + sum_columns, running);
+		});
+
+		// Then down the columns, each chunk of columns on its own. Every row
+		// adds the previous one, which vectorizes across the chunk. The
+		// padding rows below the grid repeat the last row.
+		int chunk_count = std::max(1, std::min(thread_pool->get_thread_count() * 4, sum_columns / MIN_CHUNK_COLUMNS));
+		thread_pool->parallel_for(chunk_count, [this, chunk_count, radius](int chunk, int worker) {
+			int first = (int)((int64_t)sum_columns * chunk / chunk_count);
+			int last = (int)((int64_t)sum_columns * (chunk + 1) / chunk_count);
+			for (int i = radius + 2; i < sum_rows; i++) {
+				const uint32_t* previous = &sums[(size_t)(i - 1) * sum_columns];
+				uint32_t* row = &sums[(size_t)i * sum_columns];
+				if (i <= rows + radius) {
+					for (int j = first; j < last; j++) {
+						row[j] += previous[j];
+					}
+				} else {
+					std::copy(previous + first, previous + last, row + first);
+				}
+			}
+		});
+	}
+
+	void step_row(int r) {
+		// Cell (r, c) is padded cell (r + radius, c + radius), its square
+		// spans padded rows r..r + 2 * radius and the same columns.
+		int side = 2 * rule.radius + 1;
+		const uint32_t* top = &sums[(size_t)r * sum_columns];
+		const uint32_t* bottom = &sums[(size_t)(r + side) * sum_columns];
+		const uint8_t* cell_row = &cells[(size_t)r * columns];
+		uint8_t* next_row = &next_cells[(size_t)r * columns];
+		const uint8_t* table = transitions.data();
+
+		for (int c = 0; c < columns; c++) {
+			uint32_t count = bottom[c + side] - top[c + side] - bottom[c] + top[c];
+			next_row[c] = table[cell_row[c] * count_stride + count];
+		}
+	}
+};
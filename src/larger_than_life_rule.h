@@ -0,0 +1,182 @@
+#pragma once
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "life_rule.h"
+
+// Larger than Life rule: the neighbourhood is the (2 * radius + 1)^2 square
+// around a cell, optionally including the cell itself. A dead cell is born if
+// its count lies in birth_min..birth_max and a live cell survives if it lies
+// in survive_min..survive_max. With states above 2 cells that die go through
+// dying states first, as in Generations rules; only live cells are counted.
+struct LargerThanLifeRule {
+	static const int MAX_RADIUS = 10;
+
+	int radius{ 1 };
+	int states{ 2 };
+	bool include_middle{ false };
+	// Neighbour counts that cause a birth / survival, indexed by count.
+	std::vector<uint8_t> birth;
+	std::vector<uint8_t> survive;
+
+	LargerThanLifeRule() : LargerThanLifeRule(LifeRule()) {}
+
+	// The same rule on the radius 1 neighbourhood.
+	LargerThanLifeRule(LifeRule rule) {
+		states = rule.states;
+		birth.assign(max_count(), 0);
+		survive.assign(max_count(), 0);
+		for (int n = 0; n <= 8; n++) {
+			birth[n] = rule.next_state(false, n);
+			survive[n] = rule.next_state(true, n);
+		}
+	}
+
+	// Largest possible count plus one.
+	int max_count() {
+		return (2 * radius + 1) * (2 * radius + 1) + 1;
+	}
+
+	// Golly's notation, "R5,C0,M1,S34..58,B34..45,NM" (Bosco's rule): radius,
+	// number of states (0 and 1 mean 2), whether the middle cell counts and
+	// the survive and birth ranges. The neighbourhood must be Moore (NM), the
+	// only one that is a square. Prints an error and returns false if the
+	// string is not a valid rule.
+	static bool parse(const std::string& text, LargerThanLifeRule& rule) {
+		int radius = -1;
+		int states = 2;
+		int middle = 0;
+		int birth_min = -1, birth_max = -1;
+		int survive_min = -1, survive_max = -1;
+
+		size_t start = 0;
+		while (start <= text.size()) {
+			size_t end = text.find(',', start);
+			if (end == std::string::npos) {
+				end = text.size();
+			}
+			std::string part = text.substr(start, end - start);
+			start = end + 1;
+			if (part.empty()) {
+				return invalid(text);
+			}
+			char key = (char)std::toupper((unsigned char)part[0]);
+			std::string value = part.substr(1);
+			if (key == 'R') {
+				if (!parse_number(value, radius) || radius < 1 || radius > MAX_RADIUS) {
+					std::cout << "Invalid rule string: " << text << ", the radius must be 1.." << MAX_RADIUS << "." << std::endl;
+					return false;
+				}
+			} else if (key == 'C') {
+				if (!parse_number(value, states) || states > LifeRule::MAX_STATES) {
+					return invalid(text);
+				}
+				states = states < 2 ? 2 : states;
+			} else if (key == 'M') {
+				if (!parse_number(value, middle) || middle > 1) {
+					return invalid(text);
+				}
+			} else if (key == 'S') {
+				if (!parse_range(value, survive_min, survive_max)) {
+					return invalid(text);
+				}
+			} else if (key == 'B') {
+				if (!parse_range(value, birth_min, birth_max)) {
+					return invalid(text);
+				}
+			} else if (key == 'N') {
+				if (value != "M" && value != "m") {
+					std::cout << "Invalid rule string: " << text << ", only the Moore neighbourhood (NM) is supported." << std::endl;
+					return false;
+				}
+			} else {
+				return invalid(text);
+			}
+		}
+		if (radius < 0 || birth_min < 0 || survive_min < 0) {
+			return invalid(text);
+		}
+
+		rule.radius = radius;
+		rule.states = states;
+		rule.include_middle = middle == 1;
+		rule.birth.assign(rule.max_count(), 0);
+		rule.survive.assign(rule.max_count(), 0);
+		for (int n = birth_min; n <= birth_max && n < rule.max_count(); n++) {
+			rule.birth[n] = 1;
+		}
+		for (int n = survive_min; n <= survive_max && n < rule.max_count(); n++) {
+			rule.survive[n] = 1;
+		}
+		return true;
+	}
+
+	// Golly's notation, as far as birth and survive are ranges. Rules that
+	// came from a LifeRule with gaps in its counts print the outermost counts.
+	std::string to_string() {
+		std::string text = "R";
+		text += std::to_string(radius);
+		text += ",C";
+		text += std::to_string(states == 2 ? 0 : states);
+		text += ",M";
+		text += include_middle ? "1" : "0";
+		text += ",S";
+		text += range_to_string(survive);
+		text += ",B";
+		text += range_to_string(birth);
+		text += ",NM";
+		return text;
+	}
+
+private:
+	static bool invalid(const std::string& text) {
+		std::cout << "Invalid rule string: " << text << std::endl;
+		return false;
+	}
+
+	static bool parse_number(const std::string& text, int& number) {
+		if (text.empty() || text.size() > 4) {
+			return false;
+		}
+		number = 0;
+		for (char ch : text) {
+			if (ch < '0' || ch > '9') {
+				return false;
+			}
+			number = number * 10 + (ch - '0');
+		}
+		return true;
+	}
+
+	// "3..5" or a single count "3".
+	static bool parse_range(const std::string& text, int& min, int& max) {
+		size_t dots = text.find("..");
+		if (dots == std::string::npos) {
+			if (!parse_number(text, min)) {
+				return false;
+			}
+			max = min;
+			return true;
+		}
+		return parse_number(text.substr(0, dots), min) && parse_number(text.substr(dots + 2), max) && min <= max;
+	}
+
+	static std::string range_to_string(std::vector<uint8_t>& counts) {
+		int min = -1;
+		int max = -1;
+		for (int n = 0; n < (int)counts.size(); n++) {
+			if (counts[n]) {
+				min = min < 0 ? n : min;
+				max = n;
+			}
+		}
+		if (min < 0) {
+			// Golly has no empty range, use one past the largest count.
+			return std::to_string(counts.size()) + ".." + std::to_string(counts.size());
+		}
+		return std::to_string(min) + ".." + std::to_string(max);
+	}
+};
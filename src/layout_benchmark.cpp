@@ -0,0 +1,47 @@
+// Compares the ByteGrid storage layouts on square grids from 1k to 16k.
+// Usage: layout_benchmark [max_side]
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "byte_grid.h"
+
+template <typename Layout>
+void benchmark_layout(int side) {
+	ByteGrid<Layout> grid(side, side);
+	std::mt19937 random(side);
+	for (int r = 0; r < side; r++) {
+		for (int c = 0; c < side; c++) {
+			grid.set_alive(r, c, random() % 3 == 0);
+		}
+	}
+
+	// Aim for roughly the same amount of work per grid size.
+	double cells = (double)side * side;
+	int generations = (int)(64.0 * 1024 * 1024 / cells);
+	if (generations < 1) {
+		generations = 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < generations; i++) {
+		grid.step();
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << side << "x" << side << "\t" << Layout::name() << "\t"
+		<< generations / seconds << " gen/s\t"
+		<< cells * generations / seconds / 1e6 << " Mcells/s" << std::endl;
+}
+
+int main(int argc, char** args) {
+	int max_side = argc > 1 ? std::atoi(args[1]) : 16384;
+	for (int side = 1024; side <= max_side; side *= 2) {
+		benchmark_layout<RowMajorLayout>(side);
+		benchmark_layout<ColumnMajorLayout>(side);
+		benchmark_layout<Tiled64Layout>(side);
+		benchmark_layout<MortonLayout>(side);
+	}
+	return 0;
+}
@@ -0,0 +1,224 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "life_engine.h"
+#include "lenia_rule.h"
+#include "fft.h"
+#include "thread_pool.h"
+
+// Continuous cellular automaton (Lenia): every cell holds a float in [0, 1].
+//
+// The potential of all cells is one convolution with the rule's kernel, done
+// as a product of spectra: the grid is copied into a zero-padded power-of-two
+// array, big enough that the kernel never wraps from one edge to the other,
+// so cells outside the grid count as 0 like the dead border of the other
+// engines. The kernel spectrum is computed once per rule. Per generation the
+// row transforms, the column transforms (forward, multiply, inverse fused per
+// column) and the inverse rows with the growth update each run on the thread
+// pool. Rows of the padding are all zero and are not transformed.
+class LeniaGrid : public LifeEngine {
+public:
+	LeniaGrid(int rows1, int columns1) {
+		rows = rows1;
+		columns = columns1;
+		cells.assign((size_t)rows * columns, 0.0f);
+		thread_pool = std::make_unique<ThreadPool>((int)std::thread::hardware_concurrency());
+		set_lenia_rule(LeniaRule());
+	}
+
+	void step() override {
+		float dt = 1.0f / rule.time_steps;
+		float mean = rule.growth_mean;
+		float inverse_two_sigma_squared = 1.0f / (2 * rule.growth_sigma * rule.growth_sigma);
+		int spectrum_columns = fft.spectrum_columns;
+
+		thread_pool->parallel_for(rows, [this](int r, int worker) {
+			float* padded_row = scratch[worker].real_row.data();
+			std::copy_n(&cells[(size_t)r * columns], columns, padded_row);
+			fft.forward_row(padded_row, &spectrum[(size_t)r * fft.spectrum_columns]);
+		});
+		std::fill(spectrum.begin() + (size_t)rows * spectrum_columns, spectrum.end(), Complex{ 0, 0 });
+
+		thread_pool->parallel_for(spectrum_columns, [this, spectrum_columns](int c, int worker) {
+			Complex* column = scratch[worker].column.data();
+			for (int r = 0; r < fft.rows; r++) {
+				column[r] = spectrum[(size_t)r * spectrum_columns + c];
+			}
+			column_fft.transform(column, false);
+			const Complex* kernel_column = &kernel_spectrum[(size_t)c * fft.rows];
+			for (int r = 0; r < fft.rows; r++) {
+				column[r] = column[r] * kernel_column[r];
+			}
+			column_fft.transform(column, true);
+			// Only the grid rows are needed from here on.
+			for (int r = 0; r < rows; r++) {
+				spectrum[(size_t)r * spectrum_columns + c] = column[r];
+			}
+		});
+
+		thread_pool->parallel_for(rows, [this, dt, mean, inverse_two_sigma_squared](int r, int worker) {
+			float* potential = scratch[worker].potential.data();
+			fft.inverse_row(&spectrum[(size_t)r * fft.spectrum_columns], potential);
+			float* row = &cells[(size_t)r * columns];
+			for (int c = 0; c < columns; c++) {
+				float d = potential[c] - mean;
+				float growth = 2 * exp_non_positive(-d * d * inverse_two_sigma_squared) - 1;
+				row[c] = std::min(std::max(row[c] + dt * growth, 0.0f), 1.0f);
+			}
+		});
+	}
+
+	void set_thread_count(int thread_count) {
+		thread_pool = std::make_unique<ThreadPool>(thread_count);
+		resize_scratch();
+	}
+
+	// A cell counts as alive from 0.5 up.
+	bool is_alive(int r, int c) override {
+		return cells[(size_t)r * columns + c] >= 0.5f;
+	}
+
+	void set_alive(int r, int c, bool alive) override {
+		cells[(size_t)r * columns + c] = alive ? 1.0f : 0.0f;
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	bool set_rule(LifeRule rule1) override {
+		std::cout << "Lenia cannot run " << rule1.to_string() << ", it needs a Lenia rule." << std::endl;
+		return false;
+	}
+
+	// Lenia rules have no LifeRule equivalent, this is always Conway.
+	LifeRule get_rule() override {
+		return LifeRule();
+	}
+
+	int get_state_count() override {
+		return 256;
+	}
+
+	bool has_continuous_cells() override {
+		return true;
+	}
+
+	// Cell values scaled to 0..255.
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		for (int dr = 0; dr < height; dr++) {
+			const float* row = &cells[(size_t)(r + dr) * columns + c];
+			for (int dc = 0; dc < width; dc++) {
+				out[dr * width + dc] = (uint8_t)(row[dc] * 255.0f + 0.5f);
+			}
+		}
+	}
+
+	float get_value(int r, int c) {
+		return cells[(size_t)r * columns + c];
+	}
+
+	void set_value(int r, int c, float value) {
+		cells[(size_t)r * columns + c] = std::min(std::max(value, 0.0f), 1.0f);
+	}
+
+	// Resizes the transforms for the kernel and caches its spectrum.
+	void set_lenia_rule(LeniaRule rule1) {
+		rule = rule1;
+		int fft_rows = (int)std::bit_ceil((unsigned)(rows + rule.radius));
+		int fft_columns = std::max((int)std::bit_ceil((unsigned)(columns + rule.radius)), 2);
+		fft = RealFft2D(fft_rows, fft_columns);
+		column_fft = Fft(fft_rows);
+		spectrum.assign((size_t)fft_rows * fft.spectrum_columns, Complex{ 0, 0 });
+		resize_scratch();
+
+		// The kernel centred on (0, 0), negative offsets wrapped to the far end.
+		std::vector<float> kernel((size_t)fft_rows * fft_columns, 0.0f);
+		double total = 0;
+		for (int dr = -rule.radius; dr <= rule.radius; dr++) {
+			for (int dc = -rule.radius; dc <= rule.radius; dc++) {
+				float weight = rule.kernel_at(std::sqrt((double)(dr * dr + dc * dc)));
+				kernel[(size_t)((dr + fft_rows) % fft_rows) * fft_columns + (dc + fft_columns) % fft_columns] = weight;
+				total += weight;
+			}
+		}
+		// Normalized to a sum of 1, with the scale of the inverse transform folded in.
+		float scale = (float)(fft.inverse_scale() / (total > 0 ? total : 1));
+
+		std::vector<Complex> kernel_rows((size_t)fft_rows * fft.spectrum_columns);
+		for (int r = 0; r < fft_rows; r++) {
+			fft.forward_row(&kernel[(size_t)r * fft_columns], &kernel_rows[(size_t)r * fft.spectrum_columns]);
+		}
+		// Stored column by column, the order the step reads it in.
+		kernel_spectrum.assign((size_t)fft.spectrum_columns * fft_rows, Complex{ 0, 0 });
+		std::vector<Complex> column(fft_rows);
+		for (int c = 0; c < fft.spectrum_columns; c++) {
+			fft.transform_column(kernel_rows.data(), c, false, column.data());
+			for (int r = 0; r < fft_rows; r++) {
+				Complex value = kernel_rows[(size_t)r * fft.spectrum_columns + c];
+				kernel_spectrum[(size_t)c * fft_rows + r] = { value.re * scale, value.im * scale };
+			}
+		}
+	}
+
+	LeniaRule get_lenia_rule() {
+		return rule;
+	}
+
+	int rows;
+	int columns;
+
+	LeniaRule rule;
+	std::vector<float> cells;
+
+	RealFft2D fft;
+	Fft column_fft;
+	// Spectrum of the padded grid, fft.rows x fft.spectrum_columns, row-major.
+	std::vector<Complex> spectrum;
+	// Scaled kernel spectrum, column-major.
+	std::vector<Complex> kernel_spectrum;
+
+	std::unique_ptr<ThreadPool> thread_pool;
+
+private:
+	struct WorkerScratch {
+		// A padded grid row, zero past the grid columns.
+		std::vector<float> real_row;
+		std::vector<float> potential;
+		std::vector<Complex> column;
+	};
+
+	void resize_scratch() {
+		scratch.assign(thread_pool->get_thread_count(), WorkerScratch());
+		for (WorkerScratch& worker_scratch : scratch) {
+			worker_scratch.real_row.assign(fft.columns, 0.0f);
+			worker_scratch.potential.assign(fft.columns, 0.0f);
+			worker_scratch.column.assign(fft.rows, Complex{ 0, 0 });
+		}
+	}
+
+	// e^x for x <= 0 without a library call, so the growth loop vectorizes
+	// (with -fno-trapping-math, see CMakeLists.txt):
+	// x = (n + f) ln 2 with n an integer and f in (-1, 0], 2^f from a
+	// polynomial and 2^n written into the exponent bits. Relative error
+	// below 2e-5, values under e^-87 come out as e^-87.
+	static float exp_non_positive(float x) {
+		float t = std::max(x, -87.0f) * 1.44269504f;
+		int n = (int)t;
+		float y = (t - (float)n) * 0.69314718f;
+		float p = 1.0f + y * (1.0f + y * (0.5f + y * (1.0f / 6 + y * (1.0f / 24 + y * (1.0f / 120 + y * (1.0f / 720))))));
+		return p * std::bit_cast<float>((n + 127) << 23);
+	}
+
+	std::vector<WorkerScratch> scratch;
+};
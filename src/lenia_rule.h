@@ -0,0 +1,132 @@
+#pragma once
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Lenia rule (Chan's notation): the potential of a cell is the weighted sum of
+// the cells within radius, weighted by a kernel of concentric rings with the
+// given peak heights, and every generation a cell moves by 1 / time_steps
+// times growth(potential), a Gaussian bump around growth_mean, clipped to
+// [0, 1]. The defaults are those of Orbium.
+struct LeniaRule {
+	static const int MAX_RADIUS = 64;
+
+	int radius{ 13 };
+	int time_steps{ 10 };
+	float growth_mean{ 0.15f };
+	float growth_sigma{ 0.015f };
+	std::vector<float> peaks{ 1.0f };
+
+	// "Lenia,R13,T10,m0.15,s0.015,b1/0.5" with any of the parts left out;
+	// b lists the ring peaks from the inside out. Prints an error and returns
+	// false if the string is not a valid rule.
+	static bool parse(const std::string& text, LeniaRule& rule) {
+		if (text.size() < 5 || text.size() == 6 || !equals_ignoring_case(text.substr(0, 5), "lenia") || (text.size() > 5 && text[5] != ',')) {
+			return invalid(text);
+		}
+		LeniaRule parsed;
+		size_t start = 6;
+		while (start < text.size()) {
+			size_t end = text.find(',', start);
+			if (end == std::string::npos) {
+				end = text.size();
+			}
+			std::string part = text.substr(start, end - start);
+			start = end + 1;
+			if (part.size() < 2) {
+				return invalid(text);
+			}
+			char key = (char)std::tolower((unsigned char)part[0]);
+			std::string value = part.substr(1);
+			double number = 0;
+			if (key == 'b') {
+				parsed.peaks.clear();
+				size_t peak_start = 0;
+				while (peak_start <= value.size()) {
+					size_t peak_end = value.find('/', peak_start);
+					if (peak_end == std::string::npos) {
+						peak_end = value.size();
+					}
+					if (!parse_number(value.substr(peak_start, peak_end - peak_start), number) || number < 0 || number > 1) {
+						return invalid(text);
+					}
+					parsed.peaks.push_back((float)number);
+					peak_start = peak_end + 1;
+				}
+				continue;
+			}
+			if (!parse_number(value, number)) {
+				return invalid(text);
+			}
+			if (key == 'r' && number >= 1 && number <= MAX_RADIUS && number == (int)number) {
+				parsed.radius = (int)number;
+			} else if (key == 't' && number >= 1 && number <= 1000 && number == (int)number) {
+				parsed.time_steps = (int)number;
+			} else if (key == 'm' && number >= 0 && number <= 1) {
+				parsed.growth_mean = (float)number;
+			} else if (key == 's' && number > 0 && number <= 1) {
+				parsed.growth_sigma = (float)number;
+			} else {
+				return invalid(text);
+			}
+		}
+		rule = parsed;
+		return true;
+	}
+
+	std::string to_string() {
+		std::ostringstream text;
+		text << "Lenia,R" << radius << ",T" << time_steps << ",m" << growth_mean << ",s" << growth_sigma << ",b";
+		for (size_t i = 0; i < peaks.size(); i++) {
+			text << (i > 0 ? "/" : "") << peaks[i];
+		}
+		return text.str();
+	}
+
+	// Kernel weight at a distance from the cell, before normalization.
+	float kernel_at(double distance) {
+		double r = distance / radius;
+		if (r >= 1) {
+			return 0;
+		}
+		// Each ring is an exp(4 - 1 / (x (1 - x))) bump over its share of the radius.
+		double ring_position = r * peaks.size();
+		int ring = (int)ring_position;
+		double x = ring_position - ring;
+		if (x <= 0) {
+			return 0;
+		}
+		return (float)(peaks[ring] * std::exp(4 - 1 / (x * (1 - x))));
+	}
+
+private:
+	static bool invalid(const std::string& text) {
+		std::cout << "Invalid rule string: " << text << std::endl;
+		return false;
+	}
+
+	static bool equals_ignoring_case(const std::string& a, const std::string& b) {
+		if (a.size() != b.size()) {
+			return false;
+		}
+		for (size_t i = 0; i < a.size(); i++) {
+			if (std::tolower((unsigned char)a[i]) != std::tolower((unsigned char)b[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool parse_number(const std::string& text, double& number) {
+		if (text.empty()) {
+			return false;
+		}
+		char* end = nullptr;
+		number = std::strtod(text.c_str(), &end);
+		return end == text.c_str() + text.size() && std::isfinite(number);
+	}
+};
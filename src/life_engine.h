@@ -0,0 +1,172 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "boundary.h"
+#include "life_rule.h"
+
+// Rows top..bottom - 1 and columns left..right - 1 of a grid.
+struct CellBox {
+	int top;
+	int left;
+	int bottom;
+	int right;
+
+	bool is_empty() {
+		return top >= bottom || left >= right;
+	}
+
+	// Grown by margin cells on every side, clipped to a rows x columns grid.
+	CellBox expanded(int margin, int rows, int columns) {
+		if (is_empty()) {
+			return *this;
+		}
+		return { std::max(top - margin, 0), std::max(left - margin, 0), std::min(bottom + margin, rows), std::min(right + margin, columns) };
+	}
+};
+
+// Read access to a grid of cells: every engine, and the snapshots the
+// simulation thread publishes for drawing. The drawing code only reads cells
+// through this.
+class CellReader {
+public:
+	virtual ~CellReader() {}
+
+	virtual bool is_alive(int r, int c) = 0;
+
+	virtual int get_rows() = 0;
+	virtual int get_columns() = 0;
+
+	// A box holding every cell that is not dead. Engines that track where
+	// their cells are return the smallest such box (empty if there are
+	// none), the others the whole grid.
+	virtual CellBox get_live_bounds() {
+		return { 0, 0, get_rows(), get_columns() };
+	}
+
+	// Number of live cells, only looking inside get_live_bounds().
+	virtual uint64_t count_live_cells() {
+		CellBox bounds = get_live_bounds();
+		uint64_t count = 0;
+		for (int r = bounds.top; r < bounds.bottom; r++) {
+			for (int c = bounds.left; c < bounds.right; c++) {
+				count += is_alive(r, c);
+			}
+		}
+		return count;
+	}
+
+	// Number of cell states, above 2 only for engines running Generations rules.
+	virtual int get_state_count() {
+		return 2;
+	}
+
+	// Engines with float cells (Lenia) read them back scaled to 0..255
+	// instead of as state numbers.
+	virtual bool has_continuous_cells() {
+		return false;
+	}
+
+	// Copy a height x width block starting at (r, c) into out, row-major, one
+	// byte per cell: the cell's state, 0 dead, 1 alive and 2.. dying. Engines
+	// with a cheaper bulk read override this.
+	virtual void read_cells(int r, int c, int height, int width, uint8_t* out) {
+		for (int dr = 0; dr < height; dr++) {
+			for (int dc = 0; dc < width; dc++) {
+				out[dr * width + dc] = is_alive(r + dr, c + dc);
+			}
+		}
+	}
+};
+
+// Common interface for the simulation backends. The DrawingGrid only talks to
+// the engine through this, so backends can be swapped without touching the
+// drawing code.
+class LifeEngine : public CellReader {
+public:
+	// Advance the universe by one generation.
+	virtual void step() = 0;
+
+	// Advance the universe by 2^k generations. Engines whose cost does not
+	// grow with the step, like HashLife, override this, the rest take the
+	// generations one at a time.
+	virtual void step_pow2(int k) {
+		for (uint64_t i = 0; i < (uint64_t(1) << k); i++) {
+			step();
+		}
+	}
+
+	virtual void set_alive(int r, int c, bool alive) = 0;
+
+	// Switch to another outer-totalistic rule. Prints an error and keeps the
+	// current rule if the engine cannot run it.
+	virtual bool set_rule(LifeRule rule1) = 0;
+	virtual LifeRule get_rule() = 0;
+
+	// Topology of the grid's edges. Engines without a halo only have the
+	// dead border; they print an error for anything else and return false.
+	virtual bool set_boundary(Boundary boundary1) {
+		if (boundary1 != Boundary::Dead) {
+			std::cout << "This engine only supports a dead boundary." << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	virtual Boundary get_boundary() {
+		return Boundary::Dead;
+	}
+
+	// A line of engine-specific counters for the status output, empty for
+	// engines without any. Called on the thread that steps the engine,
+	// whenever it publishes a snapshot.
+	virtual std::string describe_stats() {
+		return std::string();
+	}
+};
+
+enum class EngineType {
+	ByteGrid,
+	Bitboard,
+	HashLife,
+	SparseTiles,
+	Generations,
+	LargerThanLife,
+	Lenia,
+	Incremental
+};
+
+inline const char* engine_type_name(EngineType engine_type) {
+	switch (engine_type) {
+	case EngineType::ByteGrid: return "bytegrid";
+	case EngineType::Bitboard: return "bitboard";
+	case EngineType::HashLife: return "hashlife";
+	case EngineType::SparseTiles: return "sparse";
+	case EngineType::Generations: return "generations";
+	case EngineType::LargerThanLife: return "ltl";
+	case EngineType::Lenia: return "lenia";
+	case EngineType::Incremental: return "incremental";
+	}
+	return "bitboard";
+}
+
+// Accepts the names engine_type_name returns, in any case. Prints an error
+// and returns false for anything else.
+inline bool parse_engine_type(const std::string& text, EngineType& engine_type) {
+	std::string lower;
+	for (char ch : text) {
+		lower += (char)std::tolower((unsigned char)ch);
+	}
+	for (EngineType candidate : { EngineType::ByteGrid, EngineType::Bitboard, EngineType::HashLife, EngineType::SparseTiles,
+			 EngineType::Generations, EngineType::LargerThanLife, EngineType::Lenia, EngineType::Incremental }) {
+		if (lower == engine_type_name(candidate)) {
+			engine_type = candidate;
+			return true;
+		}
+	}
+	std::cout << "Unknown engine: " << text << ", expected bytegrid, bitboard, hashlife, sparse, generations, ltl, lenia or incremental." << std::endl;
+	return false;
+}
@@ -0,0 +1,315 @@
+#pragma once
+#include <bit>
+#include <bitset>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// One isotropic neighbourhood class of Hensel notation: a neighbour count, its
+// letter and one member drawn as the 3x3 cells row by row ('X' alive). The
+// classes for 5..7 neighbours are the complements of those for 3..1.
+struct HenselClass {
+	int count;
+	char letter;
+	const char* cells;
+};
+
+inline const HenselClass hensel_classes[] = {
+	{ 1, 'c', "X........" }, { 1, 'e', ".X......." },
+	{ 2, 'c', "X.X......" }, { 2, 'e', ".X...X..." }, { 2, 'k', ".X......X" },
+	{ 2, 'a', "XX......." }, { 2, 'i', ".X.....X." }, { 2, 'n', "X.......X" },
+	{ 3, 'c', "X.X...X.." }, { 3, 'e', ".X.X.X..." }, { 3, 'k', ".X...XX.." },
+	{ 3, 'a', "XX.X....." }, { 3, 'i', "X..X..X.." }, { 3, 'n', "X.XX....." },
+	{ 3, 'y', "X.X....X." }, { 3, 'q', "X......XX" }, { 3, 'j', "..X..X.X." },
+	{ 3, 'r', ".XX....X." },
+	{ 4, 'c', "X.X...X.X" }, { 4, 'e', ".X.X.X.X." }, { 4, 'k', ".X.X.XX.." },
+	{ 4, 'a', "XX.X..X.." }, { 4, 'i', "X.XX.X..." }, { 4, 'n', "X..X..X.X" },
+	{ 4, 'y', "X.X...XX." }, { 4, 'q', "X....X.XX" }, { 4, 'j', "X.X..X.X." },
+	{ 4, 'r', ".XX..X.X." }, { 4, 't', "XXX....X." }, { 4, 'w', "X..X...XX" },
+	{ 4, 'z', "XX.....XX" },
+};
+
+// Outer-totalistic rule: bit n of birth_mask / survive_mask is set if a dead /
+// live cell with n live neighbours is alive in the next generation.
+//
+// table holds the next state of every 3x3 neighbourhood, indexed with bit
+// 3 * row + column set for each live cell (bit 4 is the cell itself). It is
+// filled for every rule; non_totalistic rules can only be evaluated with it.
+//
+// states is above 2 for Generations rules: a live cell that does not survive
+// goes through the dying states 2..states - 1 before it is dead again, and
+// only live cells count as neighbours.
+struct LifeRule {
+	static const int MAX_STATES = 256;
+
+	uint16_t birth_mask{ 1 << 3 };
+	uint16_t survive_mask{ (1 << 2) | (1 << 3) };
+	bool non_totalistic{ false };
+	int states{ 2 };
+	std::bitset<512> table;
+
+	static const int CENTER_BIT = 1 << 4;
+
+	LifeRule() {
+		fill_table_from_masks();
+	}
+
+	static LifeRule conway() {
+		return LifeRule();
+	}
+
+	// Accepts "B3/S23" style strings in either order and case, and the older
+	// "23/3" survive/birth notation. Counts may be followed by Hensel letters
+	// ("B2n3/S23-q") for isotropic non-totalistic rules. Generations rules add
+	// the number of states, "B2/S/C3" or "/3" after the older notation
+	// ("345/2/4"). Prints an error and returns false if the string is not a
+	// valid rule.
+	static bool parse(const std::string& text, LifeRule& rule) {
+		// Per neighbour count, one bit per Hensel letter of that count.
+		uint16_t birth[9] = {};
+		uint16_t survive[9] = {};
+		bool has_letters = false;
+		for (char ch : text) {
+			char lower = (char)std::tolower((unsigned char)ch);
+			if (lower == 'b' || lower == 's') {
+				has_letters = true;
+			}
+		}
+
+		// Without letters the first part is the survive counts.
+		uint16_t* current = has_letters ? nullptr : survive;
+		int parts = 0;
+		// -1 until a state count has been read.
+		int states = -1;
+		bool reading_states = false;
+		size_t i = 0;
+		while (i < text.size()) {
+			char ch = text[i];
+			char lower = (char)std::tolower((unsigned char)ch);
+			if (lower == 'b') {
+				current = birth;
+				reading_states = false;
+				i++;
+			} else if (lower == 's') {
+				current = survive;
+				reading_states = false;
+				i++;
+			} else if (lower == 'c') {
+				// Hensel letters are consumed after their count, so a letter
+				// here starts the state count.
+				current = nullptr;
+				reading_states = true;
+				i++;
+			} else if (ch == '/') {
+				parts++;
+				if (parts == 2) {
+					current = nullptr;
+					reading_states = true;
+				} else if (!has_letters) {
+					current = birth;
+				}
+				i++;
+			} else if (ch >= '0' && ch <= '9' && reading_states) {
+				states = (states < 0 ? 0 : states * 10) + (ch - '0');
+				if (states > MAX_STATES) {
+					std::cout << "Invalid rule string: " << text << ", at most " << MAX_STATES << " states." << std::endl;
+					return false;
+				}
+				i++;
+			} else if (ch >= '0' && ch <= '8' && current) {
+				int n = ch - '0';
+				i++;
+				bool negate = i < text.size() && text[i] == '-';
+				if (negate) {
+					i++;
+				}
+				uint16_t letters = 0;
+				while (i < text.size() && hensel_letter_index(n, text[i]) >= 0) {
+					letters |= 1 << hensel_letter_index(n, text[i]);
+					i++;
+				}
+				if (negate && letters == 0) {
+					std::cout << "Invalid rule string: " << text << std::endl;
+					return false;
+				}
+				uint16_t all = (uint16_t)((1 << hensel_letter_count(n)) - 1);
+				current[n] |= letters == 0 ? all : (negate ? all & ~letters : letters);
+			} else if (ch == ' ') {
+				i++;
+			} else {
+				std::cout << "Invalid rule string: " << text << std::endl;
+				return false;
+			}
+		}
+		if (parts != (states < 0 ? 1 : 2) || states == 0 || states == 1) {
+			std::cout << "Invalid rule string: " << text << std::endl;
+			return false;
+		}
+
+		rule.states = states < 0 ? 2 : states;
+		rule.birth_mask = 0;
+		rule.survive_mask = 0;
+		rule.non_totalistic = false;
+		for (int n = 0; n <= 8; n++) {
+			uint16_t all = (uint16_t)((1 << hensel_letter_count(n)) - 1);
+			rule.birth_mask |= birth[n] == all ? 1 << n : 0;
+			rule.survive_mask |= survive[n] == all ? 1 << n : 0;
+			if ((birth[n] != 0 && birth[n] != all) || (survive[n] != 0 && survive[n] != all)) {
+				rule.non_totalistic = true;
+			}
+		}
+		if (!rule.non_totalistic) {
+			rule.fill_table_from_masks();
+			return true;
+		}
+
+		for (int neighbourhood = 0; neighbourhood < 512; neighbourhood++) {
+			int neighbours = neighbourhood & ~CENTER_BIT;
+			int n = std::popcount((unsigned)neighbours);
+			uint16_t* letters = (neighbourhood & CENTER_BIT) ? survive : birth;
+			rule.table[neighbourhood] = (letters[n] >> hensel_class_of(neighbours)) & 1;
+		}
+		return true;
+	}
+
+	bool is_conway() {
+		return !non_totalistic && states == 2 && birth_mask == LifeRule().birth_mask && survive_mask == LifeRule().survive_mask;
+	}
+
+	// Rules with B0 turn the empty background on, which unbounded engines cannot represent.
+	bool births_on_empty() {
+		return table[0];
+	}
+
+	bool is_generations() {
+		return states > 2;
+	}
+
+	// Whether a cell is alive next generation. Only meaningful for
+	// outer-totalistic rules; for Generations rules it is only the
+	// birth / survive part, see GenerationsGrid for the dying states.
+	bool next_state(bool alive, int neighbours_count) {
+		return ((alive ? survive_mask : birth_mask) >> neighbours_count) & 1;
+	}
+
+	bool next_state_of(int neighbourhood) {
+		return table[neighbourhood];
+	}
+
+	std::string to_string() {
+		std::string text = "B";
+		text += counts_to_string(false);
+		text += "/S";
+		text += counts_to_string(true);
+		if (is_generations()) {
+			text += "/C";
+			text += std::to_string(states);
+		}
+		return text;
+	}
+
+	// Number of letters the count n has in Hensel notation.
+	static int hensel_letter_count(int n) {
+		static const int letter_counts[9] = { 1, 2, 6, 10, 13, 10, 6, 2, 1 };
+		return letter_counts[n];
+	}
+
+	// Position of letter among the letters of count n, or -1.
+	static int hensel_letter_index(int n, char letter) {
+		const char* letters = "cekainyqjrtwz";
+		const char* found = std::strchr(letters, letter);
+		if (letter == '\0' || !found || found - letters >= hensel_letter_count(n) || hensel_letter_count(n) == 1) {
+			return -1;
+		}
+		return (int)(found - letters);
+	}
+
+	// Letter index of a neighbourhood (centre bit clear) within its count.
+	static int hensel_class_of(int neighbours) {
+		static int classes[512];
+		static bool initialized = false;
+		if (!initialized) {
+			std::memset(classes, 0, sizeof(classes));
+			for (const HenselClass& hensel_class : hensel_classes) {
+				int cells = 0;
+				for (int bit = 0; bit < 9; bit++) {
+					cells |= hensel_class.cells[bit] == 'X' ? 1 << bit : 0;
+				}
+				int index = hensel_letter_index(hensel_class.count, hensel_class.letter);
+				for (int symmetry = 0; symmetry < 8; symmetry++) {
+					int image = transform(cells, symmetry);
+					classes[image] = index;
+					// Counts 5..7 are the complements of counts 3..1.
+					if (hensel_class.count < 4) {
+						classes[~image & 0x1FF & ~CENTER_BIT] = index;
+					}
+				}
+			}
+			initialized = true;
+		}
+		return classes[neighbours];
+	}
+
+	// Applies one of the 8 symmetries of the square to a 3x3 neighbourhood:
+	// bit 0 of symmetry mirrors the columns, bits 1 and 2 rotate by 90 degrees.
+	static int transform(int cells, int symmetry) {
+		int result = 0;
+		for (int bit = 0; bit < 9; bit++) {
+			if (!((cells >> bit) & 1)) continue;
+			int r = bit / 3;
+			int c = bit % 3;
+			if (symmetry & 1) {
+				c = 2 - c;
+			}
+			for (int turn = 0; turn < symmetry >> 1; turn++) {
+				int rotated_r = c;
+				c = 2 - r;
+				r = rotated_r;
+			}
+			result |= 1 << (3 * r + c);
+		}
+		return result;
+	}
+
+private:
+	void fill_table_from_masks() {
+		for (int neighbourhood = 0; neighbourhood < 512; neighbourhood++) {
+			int n = std::popcount((unsigned)(neighbourhood & ~CENTER_BIT));
+			table[neighbourhood] = next_state(neighbourhood & CENTER_BIT, n);
+		}
+	}
+
+	// Counts of the birth or survive half, with Hensel letters where a count
+	// only has some of its neighbourhoods.
+	std::string counts_to_string(bool alive) {
+		std::string text;
+		for (int n = 0; n <= 8; n++) {
+			int letter_count = hensel_letter_count(n);
+			uint16_t letters = 0;
+			for (int neighbours = 0; neighbours < 512; neighbours++) {
+				if ((neighbours & CENTER_BIT) || std::popcount((unsigned)neighbours) != n) continue;
+				if (table[neighbours | (alive ? CENTER_BIT : 0)]) {
+					letters |= 1 << hensel_class_of(neighbours);
+				}
+			}
+			uint16_t all = (uint16_t)((1 << letter_count) - 1);
+			if (letters == 0) continue;
+			text += (char)('0' + n);
+			if (letters == all) continue;
+
+			const char* names = "cekainyqjrtwz";
+			bool negate = std::popcount((unsigned)letters) * 2 > letter_count;
+			if (negate) {
+				text += '-';
+			}
+			for (int i = 0; i < letter_count; i++) {
+				if (((letters >> i) & 1) != negate) {
+					text += names[i];
+				}
+			}
+		}
+		return text;
+	}
+};
@@ -0,0 +1,190 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "life_rule.h"
+
+enum class CircuitOp : uint8_t {
+	And,
+	Or,
+	Xor,
+	// a & ~b
+	AndNot
+};
+
+struct CircuitInstruction {
+	CircuitOp op;
+	uint8_t destination;
+	uint8_t a;
+	uint8_t b;
+};
+
+// A straight-line program of bitwise operations that evaluates an
+// outer-totalistic rule on the neighbour count planes, 64 cells per word.
+// The first registers hold the inputs and constants, every instruction writes
+// a new register and the next generation ends up in result_register.
+//
+// compile() searches for the smallest formula over the ones, twos, fours and
+// alive planes (8 neighbours look like 0 in those, eights is only used to
+// patch that case up), so most rules need only a handful of operations on top
+// of the neighbour count.
+struct RuleCircuit {
+	static const int ONES = 0;
+	static const int TWOS = 1;
+	static const int FOURS = 2;
+	static const int EIGHTS = 3;
+	static const int ALIVE = 4;
+	static const int ZERO = 5;
+	static const int ONE_BITS = 6;
+	static const int FIRST_TEMPORARY = 7;
+	static const int MAX_REGISTERS = 40;
+
+	std::vector<CircuitInstruction> instructions;
+	int result_register{ ZERO };
+	int register_count{ FIRST_TEMPORARY };
+
+	static RuleCircuit compile(LifeRule rule) {
+		// Truth table over ones | twos << 1 | fours << 2 | alive << 3.
+		uint16_t target = 0;
+		for (int index = 0; index < 16; index++) {
+			int count = (index & 1) + ((index >> 1) & 1) * 2 + ((index >> 2) & 1) * 4;
+			if (rule.next_state((index >> 3) & 1, count)) {
+				target |= 1 << index;
+			}
+		}
+
+		RuleCircuit circuit;
+		FormulaTable& table = formula_table();
+		table.build_until(target);
+		std::unordered_map<uint16_t, int> registers;
+		circuit.result_register = circuit.emit(table, target, registers);
+
+		// With 8 neighbours the planes read as 0 neighbours, flip the result
+		// where the rule treats the two differently.
+		bool flip_dead = rule.next_state(false, 8) != rule.next_state(false, 0);
+		bool flip_alive = rule.next_state(true, 8) != rule.next_state(true, 0);
+		if (flip_dead || flip_alive) {
+			int flip = EIGHTS;
+			if (flip_dead != flip_alive) {
+				flip = circuit.add(flip_alive ? CircuitOp::And : CircuitOp::AndNot, EIGHTS, ALIVE);
+			}
+			circuit.result_register = circuit.add(CircuitOp::Xor, circuit.result_register, flip);
+		}
+		return circuit;
+	}
+
+	// Scalar evaluation, used where the rule is applied a word at a time.
+	uint64_t evaluate(uint64_t ones, uint64_t twos, uint64_t fours, uint64_t eights, uint64_t alive) const {
+		uint64_t registers[MAX_REGISTERS] = { ones, twos, fours, eights, alive, 0, ~uint64_t(0) };
+		for (const CircuitInstruction& instruction : instructions) {
+			uint64_t a = registers[instruction.a];
+			uint64_t b = registers[instruction.b];
+			switch (instruction.op) {
+			case CircuitOp::And: registers[instruction.destination] = a & b; break;
+			case CircuitOp::Or: registers[instruction.destination] = a | b; break;
+			case CircuitOp::Xor: registers[instruction.destination] = a ^ b; break;
+			case CircuitOp::AndNot: registers[instruction.destination] = a & ~b; break;
+			}
+		}
+		return registers[result_register];
+	}
+
+private:
+	// Smallest formula (counted in operations) for every function of the four
+	// inputs, found level by level: level k combines two formulas whose costs
+	// add up to k - 1. Levels are only built as far as a rule needs them.
+	struct FormulaTable {
+		static const uint8_t UNKNOWN = 0xFF;
+
+		uint8_t cost[65536];
+		CircuitOp op[65536];
+		uint16_t left[65536];
+		uint16_t right[65536];
+		std::vector<std::vector<uint16_t>> levels;
+
+		FormulaTable() {
+			for (int f = 0; f < 65536; f++) {
+				cost[f] = UNKNOWN;
+			}
+			levels.emplace_back();
+			for (uint16_t f : { input_table(ONES), input_table(TWOS), input_table(FOURS), input_table(ALIVE), input_table(ZERO), input_table(ONE_BITS) }) {
+				cost[f] = 0;
+				levels[0].push_back(f);
+			}
+		}
+
+		void build_until(uint16_t target) {
+			while (cost[target] == UNKNOWN) {
+				int k = (int)levels.size();
+				levels.emplace_back();
+				for (int i = 0; i <= (k - 1) / 2; i++) {
+					int j = k - 1 - i;
+					for (uint16_t f : levels[i]) {
+						for (uint16_t g : levels[j]) {
+							add(k, CircuitOp::And, f, g, f & g);
+							add(k, CircuitOp::Or, f, g, f | g);
+							add(k, CircuitOp::Xor, f, g, f ^ g);
+							add(k, CircuitOp::AndNot, f, g, f & ~g);
+							add(k, CircuitOp::AndNot, g, f, g & ~f);
+						}
+					}
+				}
+			}
+		}
+
+		void add(int k, CircuitOp operation, uint16_t a, uint16_t b, uint16_t f) {
+			if (cost[f] != UNKNOWN) {
+				return;
+			}
+			cost[f] = (uint8_t)k;
+			op[f] = operation;
+			left[f] = a;
+			right[f] = b;
+			levels[k].push_back(f);
+		}
+	};
+
+	static uint16_t input_table(int input_register) {
+		switch (input_register) {
+		case ONES: return 0xAAAA;
+		case TWOS: return 0xCCCC;
+		case FOURS: return 0xF0F0;
+		case ALIVE: return 0xFF00;
+		case ONE_BITS: return 0xFFFF;
+		default: return 0;
+		}
+	}
+
+	static FormulaTable& formula_table() {
+		static FormulaTable* table = new FormulaTable();
+		return *table;
+	}
+
+	int add(CircuitOp op, int a, int b) {
+		int destination = register_count++;
+		instructions.push_back(CircuitInstruction{ op, (uint8_t)destination, (uint8_t)a, (uint8_t)b });
+		return destination;
+	}
+
+	// Writes the instructions for f and returns its register. Subformulas that
+	// occur more than once are only computed once.
+	int emit(FormulaTable& table, uint16_t f, std::unordered_map<uint16_t, int>& registers) {
+		if (table.cost[f] == 0) {
+			for (int input = ONES; input < FIRST_TEMPORARY; input++) {
+				if (input != EIGHTS && input_table(input) == f) {
+					return input;
+				}
+			}
+		}
+		auto found = registers.find(f);
+		if (found != registers.end()) {
+			return found->second;
+		}
+		int a = emit(table, table.left[f], registers);
+		int b = emit(table, table.right[f], registers);
+		int destination = add(table.op[f], a, b);
+		registers[f] = destination;
+		return destination;
+	}
+};
@@ -0,0 +1,296 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "life_engine.h"
+#include "triple_buffer.h"
+
+// One generation of a grid as the simulation thread saw it, immutable once
+// published. Only the cells inside live_bounds are stored, everything else is
+// dead, so taking a snapshot of a small pattern on a big grid is cheap.
+class GridSnapshot : public CellReader {
+public:
+	GridSnapshot() {
+		generation = 0;
+		rows = 0;
+		columns = 0;
+		state_count = 2;
+		continuous = false;
+		live_bounds = { 0, 0, 0, 0 };
+		population = 0;
+	}
+
+	// Copies the engine's cells. Runs on the simulation thread.
+	void capture(LifeEngine& engine, uint64_t generation1) {
+		generation = generation1;
+		rows = engine.get_rows();
+		columns = engine.get_columns();
+		state_count = engine.get_state_count();
+		continuous = engine.has_continuous_cells();
+		live_bounds = engine.get_live_bounds();
+		population = engine.count_live_cells();
+		stats = engine.describe_stats();
+		int width = live_bounds.right - live_bounds.left;
+		cells.resize(live_bounds.is_empty() ? 0 : (size_t)(live_bounds.bottom - live_bounds.top) * width);
+		if (!cells.empty()) {
+			engine.read_cells(live_bounds.top, live_bounds.left, live_bounds.bottom - live_bounds.top, width, cells.data());
+		}
+	}
+
+	bool is_alive(int r, int c) override {
+		return state_at(r, c) == 1;
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	CellBox get_live_bounds() override {
+		return live_bounds;
+	}
+
+	uint64_t count_live_cells() override {
+		return population;
+	}
+
+	int get_state_count() override {
+		return state_count;
+	}
+
+	bool has_continuous_cells() override {
+		return continuous;
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		int width_inside = live_bounds.right - live_bounds.left;
+		for (int dr = 0; dr < height; dr++) {
+			uint8_t* out_row = &out[(size_t)dr * width];
+			int row = r + dr;
+			if (row < live_bounds.top || row >= live_bounds.bottom) {
+				std::fill_n(out_row, width, 0);
+				continue;
+			}
+			// Copy the part of the row inside the bounds, zero the rest.
+			int first = std::clamp(live_bounds.left - c, 0, width);
+			int last = std::clamp(live_bounds.right - c, first, width);
+			const uint8_t* cells_row = &cells[(size_t)(row - live_bounds.top) * width_inside];
+			std::fill_n(out_row, first, 0);
+			std::copy_n(cells_row + (c + first - live_bounds.left), last - first, out_row + first);
+			std::fill_n(out_row + last, width - last, 0);
+		}
+	}
+
+	uint64_t generation;
+	int rows;
+	int columns;
+	int state_count;
+	bool continuous;
+	CellBox live_bounds;
+	uint64_t population;
+	// LifeEngine::describe_stats at the time of the snapshot.
+	std::string stats;
+	// The cells inside live_bounds, row-major.
+	std::vector<uint8_t> cells;
+
+private:
+	uint8_t state_at(int r, int c) {
+		if (r < live_bounds.top || r >= live_bounds.bottom || c < live_bounds.left || c >= live_bounds.right) {
+			return 0;
+		}
+		return cells[(size_t)(r - live_bounds.top) * (live_bounds.right - live_bounds.left) + c - live_bounds.left];
+	}
+};
+
+// Something the UI asks the simulation thread to do to the engine.
+struct SimulationCommand {
+	enum class Type {
+		Step,
+		Flip,
+		SetStepLog2,
+	};
+	Type type;
+	int r;
+	int c;
+	// For SetStepLog2: later steps advance 2^step_log2 generations.
+	int step_log2{ 0 };
+};
+
+// Runs an engine on its own thread, so a slow generation never stalls input
+// or drawing and drawing never throttles the simulation.
+//
+// The engine belongs to this thread while it runs. The UI sends it commands
+// (flip a cell, step once, set the step size, run or pause) through a small mutex-protected
+// queue that it works through in order, and the thread publishes snapshots
+// of the grid through a lock-free TripleBuffer that the render thread reads
+// from. While running freely a snapshot is only taken when the reader has
+// caught up with the last one, the generations in between are not copied at
+// all. When there is nothing to do the thread sleeps.
+class SimulationThread {
+public:
+	SimulationThread(LifeEngine& engine1, uint64_t generation1 = 0) : engine(engine1) {
+		generation = generation1;
+		version = 0;
+		published_version = 0;
+		step_log2 = 0;
+		running = false;
+		quit = false;
+		snapshots.write_slot().capture(engine, generation);
+		snapshots.publish();
+		thread = std::thread([this]() { run(); });
+	}
+
+	~SimulationThread() {
+		stop();
+	}
+
+	// Runs the commands already sent and joins the thread. The engine is the
+	// caller's again afterwards.
+	void stop() {
+		if (!thread.joinable()) {
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			quit = true;
+		}
+		wake.notify_one();
+		thread.join();
+	}
+
+	SimulationThread(const SimulationThread&) = delete;
+	SimulationThread& operator=(const SimulationThread&) = delete;
+
+	// Step continuously or wait for commands.
+	void set_running(bool running1) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = running1;
+		}
+		wake.notify_one();
+	}
+
+	bool is_running() {
+		return running;
+	}
+
+	void step_once() {
+		send({ SimulationCommand::Type::Step, 0, 0 });
+	}
+
+	void flip(int r, int c) {
+		send({ SimulationCommand::Type::Flip, r, c });
+	}
+
+	// Every step after this advances 2^k generations, see LifeEngine::step_pow2.
+	void set_step_log2(int k) {
+		send({ SimulationCommand::Type::SetStepLog2, 0, 0, k });
+	}
+
+	// Render side: is there a snapshot newer than snapshot().
+	bool has_new_snapshot() {
+		return snapshots.has_fresh();
+	}
+
+	// Render side: takes the newest snapshot, false if there is none newer.
+	bool acquire_snapshot() {
+		return snapshots.acquire();
+	}
+
+	GridSnapshot& snapshot() {
+		return snapshots.read_slot();
+	}
+
+	// Generation of the newest state, for restarting the thread on the same engine.
+	uint64_t get_generation() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return generation;
+	}
+
+private:
+	void send(SimulationCommand command) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			commands.push_back(command);
+		}
+		wake.notify_one();
+	}
+
+	void run() {
+		std::vector<SimulationCommand> commands_to_run;
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			wake.wait(lock, [this]() { return quit || running || !commands.empty() || published_version != version; });
+			// Commands sent before stopping still reach the engine.
+			if (quit && commands.empty()) {
+				return;
+			}
+			// Commands run in the order they were sent, then a running
+			// simulation takes one more step.
+			commands_to_run.swap(commands);
+			bool step_freely = running && !quit;
+			lock.unlock();
+
+			uint64_t generations = 0;
+			for (SimulationCommand& command : commands_to_run) {
+				if (command.type == SimulationCommand::Type::Step) {
+					engine.step_pow2(step_log2);
+					generations += uint64_t(1) << step_log2;
+				} else if (command.type == SimulationCommand::Type::Flip) {
+					engine.set_alive(command.r, command.c, !engine.is_alive(command.r, command.c));
+				} else {
+					step_log2 = command.step_log2;
+				}
+			}
+			if (step_freely) {
+				engine.step_pow2(step_log2);
+				generations += uint64_t(1) << step_log2;
+			}
+
+			lock.lock();
+			generation += generations;
+			if (!commands_to_run.empty() || generations > 0) {
+				version++;
+			}
+			commands_to_run.clear();
+			// Every state is shown once the simulation stops, while running
+			// only the ones the reader can keep up with.
+			bool publish = published_version != version && (snapshots.reader_caught_up() || !running);
+			if (publish) {
+				uint64_t snapshot_generation = generation;
+				published_version = version;
+				lock.unlock();
+				snapshots.write_slot().capture(engine, snapshot_generation);
+				snapshots.publish();
+				lock.lock();
+			}
+		}
+	}
+
+	LifeEngine& engine;
+	TripleBuffer<GridSnapshot> snapshots;
+
+	std::mutex mutex;
+	std::condition_variable wake;
+	// Guarded by mutex.
+	uint64_t generation;
+	// Counts changes to the cells, published_version the one last published.
+	uint64_t version;
+	uint64_t published_version;
+	std::atomic<bool> running;
+	bool quit;
+	std::vector<SimulationCommand> commands;
+	// Only used by the simulation thread.
+	int step_log2;
+
+	std::thread thread;
+};
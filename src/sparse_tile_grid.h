@@ -0,0 +1,295 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+#include "life_engine.h"
+#include "bitboard_kernels.h"
+
+// 64 x 64 cells, one word per row, bit i of a word is column i of the tile.
+struct SparseTile {
+	int32_t tile_y;
+	int32_t tile_x;
+	uint64_t cells[64];
+	uint64_t next_cells[64];
+	// Steps in a row the tile ended empty and no live cell next to it
+	// needed it.
+	int empty_generations;
+};
+
+// Unbounded universe stored as a hash map of bit-packed tiles. Tiles are
+// allocated when live cells reach their edge and freed again once they have
+// been dead and unneeded for EMPTY_TILE_GENERATIONS steps, so memory follows
+// the live area instead of the bounding box, and a still life or oscillator
+// touching a tile edge does not allocate and free the tile next to it every
+// generation. Like HashLifeGrid, the DrawingGrid sees a rows x columns viewport whose
+// top left corner is viewport_top/viewport_left.
+class SparseTileGrid : public LifeEngine {
+public:
+	static const int EMPTY_TILE_GENERATIONS = 8;
+
+	SparseTileGrid(int rows1, int columns1) {
+		rows = rows1;
+		columns = columns1;
+		viewport_top = 0;
+		viewport_left = 0;
+	}
+
+	~SparseTileGrid() {
+		for (auto& entry : tiles) {
+			delete entry.second;
+		}
+	}
+
+	SparseTileGrid(const SparseTileGrid&) = delete;
+	SparseTileGrid& operator=(const SparseTileGrid&) = delete;
+
+	void step() override {
+		allocate_border_tiles();
+
+		for (auto& entry : tiles) {
+			step_tile(entry.second);
+		}
+
+		// Swap and free tiles that stayed empty long enough. Tiles next to
+		// live cells had their count reset by allocate_border_tiles().
+		dead_tiles.clear();
+		for (auto& entry : tiles) {
+			SparseTile* tile = entry.second;
+			std::memcpy(tile->cells, tile->next_cells, sizeof(tile->cells));
+			if (!is_empty(tile)) {
+				tile->empty_generations = 0;
+			} else if (++tile->empty_generations >= EMPTY_TILE_GENERATIONS) {
+				dead_tiles.push_back(entry.first);
+			}
+		}
+		for (uint64_t key : dead_tiles) {
+			auto it = tiles.find(key);
+			delete it->second;
+			tiles.erase(it);
+		}
+	}
+
+	bool is_alive(int r, int c) override {
+		return get_cell(viewport_top + r, viewport_left + c);
+	}
+
+	void set_alive(int r, int c, bool alive) override {
+		set_cell(viewport_top + r, viewport_left + c, alive);
+	}
+
+	int get_rows() override {
+		return rows;
+	}
+
+	int get_columns() override {
+		return columns;
+	}
+
+	// Only rules without B0 keep the space between tiles empty.
+	bool set_rule(LifeRule rule1) override {
+		if (rule1.is_generations()) {
+			std::cout << "Sparse tiles cannot run " << rule1.to_string() << ", Generations rules need the Generations engine." << std::endl;
+			return false;
+		}
+		if (rule1.births_on_empty()) {
+			std::cout << "Sparse tiles cannot run " << rule1.to_string() << ", rules with B0 are not supported." << std::endl;
+			return false;
+		}
+		rule = BitboardRule(rule1);
+		return true;
+	}
+
+	LifeRule get_rule() override {
+		return rule.life_rule;
+	}
+
+	void read_cells(int r, int c, int height, int width, uint8_t* out) override {
+		std::memset(out, 0, (size_t)height * width);
+		int64_t top = viewport_top + r;
+		int64_t left = viewport_left + c;
+		for (int64_t ty = top >> 6; ty <= (top + height - 1) >> 6; ty++) {
+			for (int64_t tx = left >> 6; tx <= (left + width - 1) >> 6; tx++) {
+				SparseTile* tile = find_tile((int32_t)ty, (int32_t)tx);
+				if (!tile) continue;
+				for (int y = 0; y < 64; y++) {
+					int64_t out_r = ty * 64 + y - top;
+					if (out_r < 0 || out_r >= height || tile->cells[y] == 0) continue;
+					for (int x = 0; x < 64; x++) {
+						int64_t out_c = tx * 64 + x - left;
+						if (out_c < 0 || out_c >= width) continue;
+						out[out_r * width + out_c] = (tile->cells[y] >> x) & 1;
+					}
+				}
+			}
+		}
+	}
+
+	bool get_cell(int64_t y, int64_t x) {
+		SparseTile* tile = find_tile((int32_t)(y >> 6), (int32_t)(x >> 6));
+		if (!tile) {
+			return false;
+		}
+		return (tile->cells[y & 63] >> (x & 63)) & 1;
+	}
+
+	void set_cell(int64_t y, int64_t x, bool alive) {
+		SparseTile* tile = find_tile((int32_t)(y >> 6), (int32_t)(x >> 6));
+		if (!tile) {
+			if (!alive) {
+				return;
+			}
+			tile = create_tile((int32_t)(y >> 6), (int32_t)(x >> 6));
+		}
+		uint64_t bit = uint64_t(1) << (x & 63);
+		if (alive) {
+			tile->cells[y & 63] |= bit;
+		} else {
+			tile->cells[y & 63] &= ~bit;
+		}
+	}
+
+	size_t get_tile_count() {
+		return tiles.size();
+	}
+
+	uint64_t get_population() {
+		uint64_t population = 0;
+		for (auto& entry : tiles) {
+			for (int y = 0; y < 64; y++) {
+				population += std::popcount(entry.second->cells[y]);
+			}
+		}
+		return population;
+	}
+
+	int rows;
+	int columns;
+	int64_t viewport_top;
+	int64_t viewport_left;
+
+	BitboardRule rule;
+
+private:
+	static uint64_t key(int32_t tile_y, int32_t tile_x) {
+		return ((uint64_t)(uint32_t)tile_y << 32) | (uint32_t)tile_x;
+	}
+
+	SparseTile* find_tile(int32_t tile_y, int32_t tile_x) {
+		auto it = tiles.find(key(tile_y, tile_x));
+		return it == tiles.end() ? nullptr : it->second;
+	}
+
+	SparseTile* create_tile(int32_t tile_y, int32_t tile_x) {
+		SparseTile* tile = new SparseTile;
+		tile->tile_y = tile_y;
+		tile->tile_x = tile_x;
+		std::memset(tile->cells, 0, sizeof(tile->cells));
+		std::memset(tile->next_cells, 0, sizeof(tile->next_cells));
+		tile->empty_generations = 0;
+		tiles[key(tile_y, tile_x)] = tile;
+		return tile;
+	}
+
+	static bool is_empty(SparseTile* tile) {
+		uint64_t any = 0;
+		for (int y = 0; y < 64; y++) {
+			any |= tile->cells[y];
+		}
+		return any == 0;
+	}
+
+	// Births can only happen next to a live cell, so a missing tile is needed
+	// only where a live cell touches that side of an existing tile. Tiles
+	// that are needed and already exist are kept alive.
+	void allocate_border_tiles() {
+		new_tiles.clear();
+		for (auto& entry : tiles) {
+			SparseTile* tile = entry.second;
+			uint64_t left_column = 0;
+			uint64_t right_column = 0;
+			for (int y = 0; y < 64; y++) {
+				left_column |= tile->cells[y] & 1;
+				right_column |= tile->cells[y] >> 63;
+			}
+			bool top = tile->cells[0] != 0;
+			bool bottom = tile->cells[63] != 0;
+			bool left = left_column != 0;
+			bool right = right_column != 0;
+
+			int32_t ty = tile->tile_y;
+			int32_t tx = tile->tile_x;
+			if (top) new_tiles.push_back(key(ty - 1, tx));
+			if (bottom) new_tiles.push_back(key(ty + 1, tx));
+			if (left) new_tiles.push_back(key(ty, tx - 1));
+			if (right) new_tiles.push_back(key(ty, tx + 1));
+			if (tile->cells[0] & 1) new_tiles.push_back(key(ty - 1, tx - 1));
+			if (tile->cells[0] >> 63) new_tiles.push_back(key(ty - 1, tx + 1));
+			if (tile->cells[63] & 1) new_tiles.push_back(key(ty + 1, tx - 1));
+			if (tile->cells[63] >> 63) new_tiles.push_back(key(ty + 1, tx + 1));
+		}
+		for (uint64_t k : new_tiles) {
+			auto it = tiles.find(k);
+			if (it == tiles.end()) {
+				create_tile((int32_t)(k >> 32), (int32_t)(uint32_t)k);
+			} else {
+				it->second->empty_generations = 0;
+			}
+		}
+	}
+
+	void step_tile(SparseTile* tile) {
+		int32_t ty = tile->tile_y;
+		int32_t tx = tile->tile_x;
+		SparseTile* north = find_tile(ty - 1, tx);
+		SparseTile* south = find_tile(ty + 1, tx);
+		SparseTile* west = find_tile(ty, tx - 1);
+		SparseTile* east = find_tile(ty, tx + 1);
+		SparseTile* north_west = find_tile(ty - 1, tx - 1);
+		SparseTile* north_east = find_tile(ty - 1, tx + 1);
+		SparseTile* south_west = find_tile(ty + 1, tx - 1);
+		SparseTile* south_east = find_tile(ty + 1, tx + 1);
+
+		// Rows -1..64 of this tile and its west/east neighbours, with the
+		// neighbour tiles' edges filled in and missing tiles read as dead.
+		uint64_t left[66];
+		uint64_t middle[66];
+		uint64_t right[66];
+		left[0] = north_west ? north_west->cells[63] : 0;
+		middle[0] = north ? north->cells[63] : 0;
+		right[0] = north_east ? north_east->cells[63] : 0;
+		for (int y = 0; y < 64; y++) {
+			left[y + 1] = west ? west->cells[y] : 0;
+			middle[y + 1] = tile->cells[y];
+			right[y + 1] = east ? east->cells[y] : 0;
+		}
+		left[65] = south_west ? south_west->cells[0] : 0;
+		middle[65] = south ? south->cells[0] : 0;
+		right[65] = south_east ? south_east->cells[0] : 0;
+
+		bool conway = rule.life_rule.is_conway();
+		bool non_totalistic = rule.life_rule.non_totalistic;
+		for (int y = 1; y <= 64; y++) {
+			if (non_totalistic) {
+				tile->next_cells[y - 1] = table_rule_word(
+					left[y - 1], middle[y - 1], right[y - 1],
+					left[y], middle[y], right[y],
+					left[y + 1], middle[y + 1], right[y + 1], rule.pair_table.data());
+				continue;
+			}
+			NeighbourCountPlanes planes = count_neighbours(
+				left[y - 1], middle[y - 1], right[y - 1],
+				left[y], middle[y], right[y],
+				left[y + 1], middle[y + 1], right[y + 1]);
+			tile->next_cells[y - 1] = conway ? conway_rule(middle[y], planes) : life_rule_result(middle[y], planes, rule.circuit);
+		}
+	}
+
+	std::unordered_map<uint64_t, SparseTile*> tiles;
+	// Scratch space, kept around so a step does not allocate.
+	std::vector<uint64_t> new_tiles;
+	std::vector<uint64_t> dead_tiles;
+};
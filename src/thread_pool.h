@@ -0,0 +1,229 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct WorkerStats {
+	// Indices of stealing jobs this worker ran, however much work each was.
+	size_t tasks_processed{ 0 };
+	// The work those tasks reported through record_work, e.g. tiles.
+	size_t work_units{ 0 };
+	// Tasks taken from another worker's queue.
+	size_t steals{ 0 };
+};
+
+// Persistent worker threads for the parallel generation steps. The threads
+// are started once and sleep between jobs, so a step does not pay for thread
+// creation. The calling thread takes part in every job as worker 0.
+class ThreadPool {
+public:
+	ThreadPool(int thread_count1) {
+		thread_count = std::max(thread_count1, 1);
+		job_id = 0;
+		stopping = false;
+		task_count = 0;
+		next_task = 0;
+		busy_workers = 0;
+		stealing = false;
+		queues = std::make_unique<WorkerQueue[]>(thread_count);
+		worker_stats.assign(thread_count, WorkerStats());
+		for (int worker = 1; worker < thread_count; worker++) {
+			threads.emplace_back([this, worker]() { worker_loop(worker); });
+		}
+	}
+
+	~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		job_ready.notify_all();
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// Runs task(index, worker) for every index in [0, count) and returns once
+	// all of them are done. Workers claim indices one at a time, so uneven
+	// tasks still spread across the threads.
+	void parallel_for(int count, const std::function<void(int, int)>& task) {
+		if (thread_count == 1 || count <= 1) {
+			for (int i = 0; i < count; i++) {
+				task(i, 0);
+			}
+			return;
+		}
+
+		run_job(count, task, false);
+	}
+
+	// Same contract as parallel_for, but every worker starts with its own
+	// contiguous share of the indices and, once that is used up, steals from
+	// the back of the other workers' queues. Used when task costs are uneven.
+	void parallel_for_stealing(int count, const std::function<void(int, int)>& task) {
+		if (thread_count == 1 || count <= 1) {
+			for (int i = 0; i < count; i++) {
+				task(i, 0);
+			}
+			worker_stats[0].tasks_processed += count;
+			return;
+		}
+
+		for (int worker = 0; worker < thread_count; worker++) {
+			queues[worker].begin = (int)((int64_t)count * worker / thread_count);
+			queues[worker].end = (int)((int64_t)count * (worker + 1) / thread_count);
+		}
+		run_job(count, task, true);
+	}
+
+	int get_thread_count() {
+		return thread_count;
+	}
+
+	// Called from a task to credit the worker running it with units of work,
+	// for tasks of different sizes. Each worker only writes its own entry.
+	void record_work(int worker, size_t units) {
+		worker_stats[worker].work_units += units;
+	}
+
+	// Counters since the last reset, one entry per worker.
+	std::vector<WorkerStats>& get_worker_stats() {
+		return worker_stats;
+	}
+
+	void reset_worker_stats() {
+		worker_stats.assign(thread_count, WorkerStats());
+	}
+
+private:
+	// One worker's share of a stealing job. The owner takes from the front,
+	// thieves from the back.
+	struct alignas(64) WorkerQueue {
+		std::mutex mutex;
+		int begin{ 0 };
+		int end{ 0 };
+	};
+
+	void run_job(int count, const std::function<void(int, int)>& task, bool use_stealing) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			current_task = &task;
+			task_count = count;
+			next_task.store(0);
+			stealing = use_stealing;
+			busy_workers = thread_count - 1;
+			job_id++;
+		}
+		job_ready.notify_all();
+
+		run_worker(0);
+
+		std::unique_lock<std::mutex> lock(mutex);
+		job_done.wait(lock, [this]() { return busy_workers == 0; });
+		current_task = nullptr;
+	}
+
+	void run_worker(int worker) {
+		if (stealing) {
+			run_stealing_tasks(worker);
+		} else {
+			run_tasks(worker);
+		}
+	}
+
+	void run_stealing_tasks(int worker) {
+		WorkerStats& stats = worker_stats[worker];
+		while (true) {
+			int i = pop_front(queues[worker]);
+			if (i < 0) {
+				i = steal(worker);
+				if (i < 0) {
+					return;
+				}
+				stats.steals++;
+			}
+			(*current_task)(i, worker);
+			stats.tasks_processed++;
+		}
+	}
+
+	int pop_front(WorkerQueue& queue) {
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.begin >= queue.end) {
+			return -1;
+		}
+		return queue.begin++;
+	}
+
+	// Tasks only leave the queues, so once a full sweep finds nothing the job
+	// has no work left for this worker.
+	int steal(int thief) {
+		for (int offset = 1; offset < thread_count; offset++) {
+			WorkerQueue& victim = queues[(thief + offset) % thread_count];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if (victim.begin < victim.end) {
+				return --victim.end;
+			}
+		}
+		return -1;
+	}
+
+	void run_tasks(int worker) {
+		while (true) {
+			int i = next_task.fetch_add(1);
+			if (i >= task_count) {
+				return;
+			}
+			(*current_task)(i, worker);
+		}
+	}
+
+	void worker_loop(int worker) {
+		int seen_job_id = 0;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				job_ready.wait(lock, [this, seen_job_id]() { return stopping || job_id != seen_job_id; });
+				if (stopping) {
+					return;
+				}
+				seen_job_id = job_id;
+			}
+
+			run_worker(worker);
+
+			std::lock_guard<std::mutex> lock(mutex);
+			busy_workers--;
+			if (busy_workers == 0) {
+				job_done.notify_one();
+			}
+		}
+	}
+
+	int thread_count;
+	std::vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable job_ready;
+	std::condition_variable job_done;
+	int job_id;
+	bool stopping;
+
+	const std::function<void(int, int)>* current_task{ nullptr };
+	int task_count;
+	std::atomic<int> next_task;
+	int busy_workers;
+
+	bool stealing;
+	std::unique_ptr<WorkerQueue[]> queues;
+	std::vector<WorkerStats> worker_stats;
+};
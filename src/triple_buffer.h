@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Lock-free handoff of values from one writer thread to one reader thread.
+// Of the three slots the writer owns one (back), the reader owns one (front)
+// and the third (middle) holds the latest published value. Publishing and
+// taking the latest value each swap a slot index with the middle in one
+// atomic exchange, so neither side ever waits for the other, the writer
+// never touches the slot being read and the reader always gets the newest
+// complete value.
+template <typename T>
+class TripleBuffer {
+public:
+	TripleBuffer() {
+		back = 0;
+		front = 2;
+	}
+
+	// The slot to fill before publish(). Owned by the writer.
+	T& write_slot() {
+		return slots[back];
+	}
+
+	// Makes the write slot the latest value and takes the old middle slot,
+	// which may hold an unread value, as the new write slot.
+	void publish() {
+		uint8_t old_middle = middle.exchange((uint8_t)(back | FRESH), std::memory_order_acq_rel);
+		back = old_middle & INDEX;
+	}
+
+	// Has the reader taken the latest published value. Lets the writer skip
+	// filling values nobody will see.
+	bool reader_caught_up() {
+		return !(middle.load(std::memory_order_acquire) & FRESH);
+	}
+
+	// Reader side: is there a value newer than read_slot().
+	bool has_fresh() {
+		return middle.load(std::memory_order_acquire) & FRESH;
+	}
+
+	// Moves the latest published value into the read slot. Returns false,
+	// keeping the read slot, if nothing was published since the last call.
+	bool acquire() {
+		if (!has_fresh()) {
+			return false;
+		}
+		uint8_t old_middle = middle.exchange((uint8_t)front, std::memory_order_acq_rel);
+		front = old_middle & INDEX;
+		return true;
+	}
+
+	// The value last acquired. Owned by the reader.
+	T& read_slot() {
+		return slots[front];
+	}
+
+private:
+	static const uint8_t INDEX = 3;
+	// Set while the middle slot holds a value the reader has not taken.
+	static const uint8_t FRESH = 4;
+
+	T slots[3];
+	std::atomic<uint8_t> middle{ 1 };
+	int back;
+	int front;
+};